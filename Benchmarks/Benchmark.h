@@ -0,0 +1,77 @@
+#pragma once
+#include "Core/Common.h"
+
+#include <chrono>
+#include <cstdio>
+
+
+/**
+* How many heap allocations have been made so far (Counted by the global operator new in Main.cpp)
+* -NOTE: Allocations made inside the Engine-Core DLL on Windows aren't seen by this, only those made by inline/header code
+*/
+uint64 GetAllocationCount();
+
+
+/**
+* Time a function over many calls and print the average time, allocations and bytes per operation
+* @param name			Label to print
+* @param iterations		Number of timed calls (A tenth as many are run first, to warm up)
+* @param opsPerCall		How many operations each call performs (Results are divided by this)
+* @param bytesPerOp		How many bytes each operation produces or consumes (0 to not print)
+* @param func			The function to time
+* @returns Average nanoseconds per operation
+*/
+template<typename Func>
+inline double RunBenchmark(const char* name, const uint32& iterations, const uint32& opsPerCall, const double& bytesPerOp, Func func)
+{
+	for (uint32 i = 0; i < iterations / 10 + 1; ++i)
+		func();
+
+	const uint64 startAllocations = GetAllocationCount();
+	const auto start = std::chrono::high_resolution_clock::now();
+	for (uint32 i = 0; i < iterations; ++i)
+		func();
+	const auto end = std::chrono::high_resolution_clock::now();
+	const uint64 allocations = GetAllocationCount() - startAllocations;
+
+	const double ops = (double)iterations * opsPerCall;
+	const double nsPerOp = std::chrono::duration<double, std::nano>(end - start).count() / ops;
+	if (bytesPerOp != 0.0)
+		printf("  %-52s %14.1f ns/op %10.1f B/op %10.2f allocs/op\n", name, nsPerOp, bytesPerOp, allocations / ops);
+	else
+		printf("  %-52s %14.1f ns/op %10s      %10.2f allocs/op\n", name, nsPerOp, "-", allocations / ops);
+	return nsPerOp;
+}
+
+/**
+* Time a function over many calls and print the average time per call
+* @param name			Label to print
+* @param iterations		Number of timed calls (A tenth as many are run first, to warm up)
+* @param func			The function to time
+* @returns Average nanoseconds per call
+*/
+template<typename Func>
+inline double RunBenchmark(const char* name, const uint32& iterations, Func func)
+{
+	return RunBenchmark(name, iterations, 1, 0.0, func);
+}
+
+/**
+* Stop the compiler from optimising away a result
+* @param value			The value which must be computed
+*/
+template<typename Type>
+inline void KeepResult(const Type& value)
+{
+	static volatile Type sink;
+	sink = value;
+}
+
+
+/**
+* Benchmark suites (Each prints its own results)
+*/
+void RunRecolourBenchmarks();
+void RunEncodingBenchmarks();
+void RunNetUpdateBenchmarks();
+void RunLoopbackBenchmarks();
@@ -0,0 +1,123 @@
+#include "Benchmark.h"
+#include "Core/Encoding.h"
+#include "Core/ByteBuffer.h"
+#include "Core/NetSerializableBase.h"
+
+#include "BLevelArena.h"
+#include "LobbyController.h"
+
+
+/// How many values are encoded/decoded per timed call
+#define ENCODE_BATCH_SIZE 256
+#define ENCODE_ITERATIONS 2000
+
+
+/**
+* Time encoding and decoding a batch of the same value
+* Decoding refills a reserved buffer from a pre-encoded copy each call (A plain copy, which doesn't allocate)
+* @param name			The name of the type
+* @param value			The value to encode
+*/
+template<typename Type>
+static void BenchmarkType(const char* name, const Type& value)
+{
+	ByteBuffer probe;
+	Encode<Type>(probe, value);
+	const uint32 bytes = probe.Size();
+
+	ByteBuffer buffer;
+	buffer.Reserve(bytes * ENCODE_BATCH_SIZE);
+	RunBenchmark(("Encode<" + string(name) + ">").c_str(), ENCODE_ITERATIONS, ENCODE_BATCH_SIZE, bytes, [&buffer, &value]()
+	{
+		buffer.Clear();
+		for (uint32 i = 0; i < ENCODE_BATCH_SIZE; ++i)
+			Encode<Type>(buffer, value);
+		KeepResult(buffer.Size());
+	});
+
+
+	ByteBuffer source;
+	for (uint32 i = 0; i < ENCODE_BATCH_SIZE; ++i)
+		Encode<Type>(source, value);
+	source.Flip();
+
+	// Decoded into a new value each time, like the net code does
+	buffer = source;
+	RunBenchmark(("Decode<" + string(name) + ">").c_str(), ENCODE_ITERATIONS, ENCODE_BATCH_SIZE, bytes, [&buffer, &source]()
+	{
+		buffer = source;
+		bool success = true;
+		for (uint32 i = 0; i < ENCODE_BATCH_SIZE; ++i)
+		{
+			Type out;
+			success &= Decode<Type>(buffer, out);
+		}
+		KeepResult(success);
+	});
+}
+
+
+/**
+* Build an arena laid out like the stone level (Walls around the edge and a repeating pattern of walls, loot and boxes)
+*/
+static ABLevelArena::TileGrid MakeArena(const uint32& size)
+{
+	ABLevelArena::TileGrid tiles(size * size, ABLevelArena::TileType::Floor);
+	for (uint32 x = 0; x < size; ++x)
+		for (uint32 y = 0; y < size; ++y)
+		{
+			ABLevelArena::TileType& tile = tiles[x + y * size];
+			if (x == 0 || y == 0 || x == size - 1 || y == size - 1)
+				tile = ABLevelArena::TileType::Wall;
+			else if (x % 3 == 2 && y % 3 == 2)
+				tile = ABLevelArena::TileType::Wall;
+			else if (x % 3 == 0 && y % 3 == 0)
+				tile = ABLevelArena::TileType::LootBox;
+			else if ((x + y) % 4 != 0)
+				tile = ABLevelArena::TileType::Box;
+		}
+	return tiles;
+}
+
+
+void RunEncodingBenchmarks()
+{
+	BenchmarkType<bool>("bool", true);
+	BenchmarkType<int8>("int8", -12);
+	BenchmarkType<int16>("int16", -1234);
+	BenchmarkType<int32>("int32", -123456);
+	BenchmarkType<int64>("int64", -1234567890123LL);
+	BenchmarkType<uint8>("uint8", 200);
+	BenchmarkType<uint16>("uint16", 60000);
+	BenchmarkType<uint32>("uint32", 4000000000U);
+	BenchmarkType<uint64>("uint64", 12345678901234ULL);
+	BenchmarkType<float>("float", 3.14159f);
+	BenchmarkType<vec2>("vec2", vec2(123.5f, -45.25f));
+	BenchmarkType<ivec2>("ivec2", ivec2(-12, 34));
+	BenchmarkType<uvec2>("uvec2", uvec2(12, 34));
+
+	BenchmarkType<string>("string (8 chars)", "Player 1");
+	BenchmarkType<string>("string (128 chars)", string(128, 'x'));
+
+	BenchmarkType<ABLevelArena::TileGrid>("TileGrid (16x16)", MakeArena(16));
+	BenchmarkType<ABLevelArena::TileGrid>("TileGrid (64x64)", MakeArena(64));
+
+	PlayerVoteMap votes;
+	for (uint16 i = 1; i <= 8; ++i)
+		votes[i] = i % 3;
+	BenchmarkType<PlayerVoteMap>("PlayerVoteMap (8 players)", votes);
+
+	RPCRequest rpc;
+	rpc.function.index = 3;
+	rpc.function.callingMode = RPCCallingMode::Broadcast;
+	rpc.function.socket = UDP;
+	Encode<vec2>(rpc.params, vec2(10.0f, 20.0f));
+	Encode<uint8>(rpc.params, 2);
+	BenchmarkType<RPCRequest>("RPCRequest (9 byte params)", rpc);
+
+	SyncVarRequest syncVar;
+	syncVar.variable.index = 1;
+	syncVar.variable.socket = UDP;
+	Encode<vec2>(syncVar.value, vec2(10.0f, 20.0f));
+	BenchmarkType<SyncVarRequest>("SyncVarRequest (vec2)", syncVar);
+}
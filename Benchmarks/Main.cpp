@@ -0,0 +1,68 @@
+#include "Benchmark.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+
+static std::atomic<uint64> s_allocationCount(0);
+
+uint64 GetAllocationCount()
+{
+	return s_allocationCount.load(std::memory_order_relaxed);
+}
+
+
+/**
+* Count every allocation, so benchmarks can report allocations per op
+*/
+void* operator new(std::size_t size)
+{
+	s_allocationCount.fetch_add(1, std::memory_order_relaxed);
+	void* ptr = std::malloc(size == 0 ? 1 : size);
+	if (ptr == nullptr)
+		throw std::bad_alloc();
+	return ptr;
+}
+
+void* operator new[](std::size_t size)
+{
+	return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+
+
+int main(int argc, char** argv)
+{
+	printf("Recolour\n");
+	RunRecolourBenchmarks();
+
+	printf("\nEncoding\n");
+	RunEncodingBenchmarks();
+
+	printf("\nNet update\n");
+	RunNetUpdateBenchmarks();
+
+	printf("\nLoopback\n");
+	RunLoopbackBenchmarks();
+	return 0;
+}
@@ -0,0 +1,443 @@
+#include "Benchmark.h"
+#include "Core/Engine.h"
+#include "Core/Game.h"
+#include "Core/Level.h"
+#include "Core/NetSession.h"
+#include "Core/NetHostSession.h"
+#include "Core/NetRemoteSession.h"
+#include "Core/NetLoopbackTransport.h"
+#include "Core/PlayerController.h"
+
+#include <algorithm>
+
+
+/// How many actor updates are timed for each world size (Divided between the updates)
+#define NET_UPDATE_ACTOR_BUDGET 200000
+
+/// How many actors are replicated over loopback (Kept small enough for a single UDP packet)
+#define LOOPBACK_ACTOR_COUNT 40
+/// How many net updates are streamed over loopback in each run (10s at the default net tick rate)
+#define LOOPBACK_UPDATE_COUNT 300
+/// How many extra net ticks are run after the stream ends
+#define LOOPBACK_DRAIN_COUNT 60
+#define LOOPBACK_ITERATIONS 20
+
+/// How many main ticks a client is given to complete the handshake over loopback
+#define LOOPBACK_SESSION_JOIN_TICKS 120
+/// How many main ticks both sessions are stepped, once connected
+#define LOOPBACK_SESSION_TICKS 600
+
+
+/**
+* Actor with a similar set of sync vars to a character (Plus location and active from AActor)
+*/
+class ABenchActor : public AActor
+{
+	CLASS_BODY(AActor)
+private:
+	vec2 m_velocity;
+	int32 m_health = 100;
+	uint8 m_direction = 0;
+
+public:
+	ABenchActor()
+	{
+		bIsNetSynced = true;
+	}
+
+	inline void Randomise(const uint32& seed)
+	{
+		SetLocation(vec2((float)(seed % 640), (float)(seed * 7 % 480)));
+		m_velocity = vec2((float)(seed % 3) - 1.0f, (float)(seed % 5) - 2.0f);
+		m_health = seed % 100;
+		m_direction = seed % 4;
+	}
+
+protected:
+	virtual void RegisterSyncVars(SyncVarQueue& outQueue, const SocketType& socketType, uint16& index, uint32& trackIndex, const bool& forceEncode) override
+	{
+		SYNCVAR_INDEX_HEADER(outQueue, socketType, index, trackIndex, forceEncode);
+		SYNCVAR_INDEX_AlwaysSync(UDP, vec2, m_velocity);
+		SYNCVAR_INDEX_AlwaysSync(UDP, int32, m_health);
+		SYNCVAR_INDEX_AlwaysSync(UDP, uint8, m_direction);
+	}
+
+	virtual bool ExecuteSyncVar(uint16& id, ByteBuffer& value, const bool& skipCallbacks) override
+	{
+		SYNCVAR_EXEC_HEADER(id, value, skipCallbacks);
+		SYNCVAR_EXEC(m_velocity);
+		SYNCVAR_EXEC(m_health);
+		SYNCVAR_EXEC(m_direction);
+		return false;
+	}
+};
+CLASS_SOURCE(ABenchActor)
+
+
+/**
+* Empty level for the bench actors to be spawned into
+*/
+class LBenchLevel : public LLevel
+{
+	CLASS_BODY(LLevel)
+};
+CLASS_SOURCE(LBenchLevel)
+
+
+/**
+* Session which is never started, so only exposes the encode/decode steps of a net update
+*/
+class BenchSession : public NetSession
+{
+public:
+	BenchSession(Game* game, const bool& isHost) :
+		NetSession(game, NetIdentity())
+	{
+		bIsHost = isHost;
+	}
+
+	inline void Prepare() { PreNetUpdate(); }
+	inline void Finish() { PostNetUpdate(); }
+	inline void Encode(ByteBuffer& buffer) { EncodeNetUpdate(nullptr, buffer, UDP); }
+	inline void Decode(ByteBuffer& buffer) { DecodeNetUpdate(nullptr, buffer, UDP); }
+};
+
+
+/**
+* Grow the world to this many actors and time a UDP update of every actor, encoded by the host and decoded by a client
+* @param spawnedCount	How many actors earlier runs have already spawned (Updated to actorCount)
+*/
+static void RunWorldSize(Game& game, BenchSession& host, BenchSession& remote, uint32& spawnedCount, const uint32& actorCount)
+{
+	LLevel* level = game.GetCurrentLevel();
+	for (AActor* actor : level->GetActiveActors())
+		actor->UpdateRole(&host);
+
+	for (; spawnedCount < actorCount; ++spawnedCount)
+		level->SpawnActor<ABenchActor>()->Randomise(spawnedCount);
+
+	// First update assigns ids and is sent as new objects over TCP, so skip past it
+	host.Prepare();
+	host.Finish();
+	host.Prepare();
+
+	const uint32 iterations = NET_UPDATE_ACTOR_BUDGET / actorCount;
+	const string suffix = " (" + std::to_string(actorCount) + " actors)";
+
+	ByteBuffer buffer;
+	host.Encode(buffer);
+	const uint32 bytes = buffer.Size();
+	buffer.Reserve(bytes);
+
+	RunBenchmark(("EncodeNetUpdate" + suffix).c_str(), iterations, 1, bytes, [&host, &buffer]()
+	{
+		buffer.Clear();
+		host.Encode(buffer);
+		KeepResult(buffer.Size());
+	});
+
+
+	// Decode as a client would, so the sync vars are actually applied
+	ByteBuffer source;
+	host.Encode(source);
+	source.Flip();
+	for (AActor* actor : level->GetActiveActors())
+		actor->UpdateRole(&remote);
+
+	ByteBuffer working;
+	working.Reserve(bytes);
+	RunBenchmark(("DecodeNetUpdate" + suffix).c_str(), iterations, 1, bytes, [&remote, &source, &working]()
+	{
+		working = source;
+		remote.Decode(working);
+		KeepResult(working.Size());
+	});
+
+	host.Finish();
+}
+
+
+/**
+* Stream host updates to a client over a loopback transport, timing the send, transport and decode
+* then print how many updates arrived and how late (The transport is seeded, so these are the same every run)
+* @param remote			Session to decode with (Actors should already have a remote role)
+* @param updates		The encoded updates to send, one per net tick (Each prefixed with its index)
+* @param name			Label for the conditions
+* @param settings		The conditions to send under
+*/
+static void RunLoopbackStream(BenchSession& remote, const std::vector<ByteBuffer>& updates, const char* name, const NetLoopbackSettings& settings)
+{
+	const NetIdentity hostIdentity(sf::IpAddress::LocalHost, 20010);
+	const float tickLength = 1.0f / 30.0f;
+
+	uint64 bytes = 0;
+	for (const ByteBuffer& update : updates)
+		bytes += update.Size();
+
+	uint32 delivered = 0;
+	double totalDelay = 0.0;
+	double maxDelay = 0.0;
+	std::vector<RawNetPacket> packets;
+
+	RunBenchmark(("LoopbackStream " + string(name)).c_str(), LOOPBACK_ITERATIONS, (uint32)updates.size(), (double)bytes / updates.size(), [&]()
+	{
+		NetLoopbackTransport transport(settings);
+		NetSocket* host = transport.BuildSocket(UDP);
+		NetSocket* client = transport.BuildSocket(UDP);
+		host->Listen(hostIdentity);
+		client->Connect(hostIdentity);
+		const NetIdentity clientIdentity = client->GetLocalIdentity();
+
+		delivered = 0;
+		totalDelay = 0.0;
+		maxDelay = 0.0;
+
+		auto receive = [&]()
+		{
+			packets.clear();
+			client->Poll(packets);
+			for (RawNetPacket& packet : packets)
+			{
+				packet.buffer.Flip();
+				uint32 index;
+				Decode<uint32>(packet.buffer, index);
+				remote.Decode(packet.buffer);
+
+				const double delay = transport.GetTime() - index * tickLength;
+				totalDelay += delay;
+				maxDelay = std::max(maxDelay, delay);
+				++delivered;
+			}
+		};
+
+		for (uint32 i = 0; i < updates.size(); ++i)
+		{
+			host->SendTo(updates[i].Data(), updates[i].Size(), clientIdentity);
+			transport.Advance(tickLength);
+			receive();
+		}
+
+		// Keep ticking for a while, to let anything still in flight land
+		for (uint32 i = 0; i < LOOPBACK_DRAIN_COUNT; ++i)
+		{
+			transport.Advance(tickLength);
+			receive();
+		}
+
+		delete client;
+		delete host;
+	});
+
+	// Delay is as seen by the client, so includes waiting for the next net tick
+	printf("    %i/%i updates delivered, %.1fms avg delay, %.1fms max delay\n",
+		delivered, (uint32)updates.size(),
+		delivered == 0 ? 0.0 : 1000.0 * totalDelay / delivered,
+		1000.0 * maxDelay
+	);
+}
+
+/**
+* Create a game which can host or join a session of bench actors
+*/
+static Game* CreateSessionGame()
+{
+	Game* game = new Game("Benchmark", Version(1, 0, 0));
+	game->RegisterClass(OPlayerController::StaticClass());
+	game->RegisterClass(ABenchActor::StaticClass());
+	game->RegisterClass(LBenchLevel::StaticClass());
+	game->defaultLevel = LBenchLevel::StaticClass();
+	game->defaultNetLevel = LBenchLevel::StaticClass();
+	return game;
+}
+
+/**
+* Host and join real sessions over one loopback transport, stepping both engines and the transport together
+* Times each main tick of both engines, then checks the handshake completed and the client applied the host's actor updates
+* @param name			Label for the conditions
+* @param settings		The conditions to send under
+*/
+static void RunLoopbackSession(const char* name, const NetLoopbackSettings& settings)
+{
+	const NetIdentity hostIdentity(sf::IpAddress::LocalHost, 20010);
+	const float tickLength = 1.0f / 60.0f;
+
+	// Transport must outlive the engines, as their sessions' sockets are closed with them
+	NetLoopbackTransport transport(settings);
+	std::vector<string> args;
+	Engine hostEngine(args);
+	Engine clientEngine(args);
+	Game* hostGame = CreateSessionGame();
+	Game* clientGame = CreateSessionGame();
+
+	hostEngine.GetNetController()->SetTransport(&transport);
+	clientEngine.GetNetController()->SetTransport(&transport);
+	hostEngine.Hook(hostGame);
+	clientEngine.Hook(clientGame);
+
+	auto step = [&]()
+	{
+		hostEngine.Tick(tickLength);
+		clientEngine.Tick(tickLength);
+		transport.Advance(tickLength);
+	};
+
+	if (!hostEngine.GetNetController()->HostSession(hostIdentity))
+	{
+		printf("  !! LoopbackSession %s could not host\n", name);
+		delete clientGame;
+		delete hostGame;
+		return;
+	}
+	step();
+
+	for (uint32 i = 0; i < LOOPBACK_ACTOR_COUNT; ++i)
+		hostGame->GetCurrentLevel()->SpawnActor<ABenchActor>()->Randomise(i);
+
+
+	// Join through the TCP listener, then UDP bound to the same port
+	clientEngine.GetNetController()->JoinSession(hostIdentity);
+	const NetRemoteSession* remote = dynamic_cast<const NetRemoteSession*>(clientEngine.GetNetController()->GetSession());
+
+	uint32 joinTicks = 0;
+	while (remote != nullptr && remote->GetConnectionStatus() != Connected && joinTicks < LOOPBACK_SESSION_JOIN_TICKS)
+	{
+		step();
+		++joinTicks;
+	}
+	if (remote == nullptr || remote->GetConnectionStatus() != Connected)
+	{
+		printf("  !! LoopbackSession %s handshake did not complete within %i ticks\n", name, LOOPBACK_SESSION_JOIN_TICKS);
+		delete clientGame;
+		delete hostGame;
+		return;
+	}
+
+
+	// Keep every actor moving, so each net update has changes to send
+	uint32 seed = 0;
+	RunBenchmark(("LoopbackSession " + string(name)).c_str(), LOOPBACK_SESSION_TICKS, [&]()
+	{
+		for (ABenchActor* actor : hostGame->GetCurrentLevel()->GetActiveActors<ABenchActor>())
+			actor->Randomise(seed++);
+		step();
+	});
+
+	// Stop moving and let the last updates land (UDP may be lost, but later updates resend the state)
+	for (uint32 i = 0; i < LOOPBACK_DRAIN_COUNT; ++i)
+		step();
+
+
+	uint32 actorCount = 0;
+	uint32 syncedCount = 0;
+	LLevel* clientLevel = clientGame->GetCurrentLevel();
+	for (ABenchActor* actor : hostGame->GetCurrentLevel()->GetActiveActors<ABenchActor>())
+	{
+		++actorCount;
+		const AActor* copy = clientLevel == nullptr ? nullptr : clientLevel->GetActorByNetID(actor->GetNetworkID());
+		if (copy != nullptr && copy->GetLocation() == actor->GetLocation())
+			++syncedCount;
+	}
+
+	printf("    Connected after %i ticks, %i/%i actors in sync, %llu packets sent (%llu dropped)\n",
+		joinTicks, syncedCount, actorCount,
+		(unsigned long long)transport.GetPacketsSent(), (unsigned long long)transport.GetPacketsDropped()
+	);
+	if (syncedCount != actorCount)
+		printf("  !! LoopbackSession %s client did not apply every actor update\n", name);
+
+	delete clientGame;
+	delete hostGame;
+}
+
+void RunLoopbackBenchmarks()
+{
+	std::vector<string> args;
+	Engine engine(args);
+
+	Game game("Benchmark", Version(1, 0, 0));
+	game.RegisterClass(ABenchActor::StaticClass());
+	game.RegisterClass(LBenchLevel::StaticClass());
+	game.defaultLevel = LBenchLevel::StaticClass();
+	game.OnGameHooked(&engine);
+	game.MainUpdate(0.0f);
+
+	BenchSession host(&game, true);
+	BenchSession remote(&game, false);
+
+	LLevel* level = game.GetCurrentLevel();
+	for (uint32 i = 0; i < LOOPBACK_ACTOR_COUNT; ++i)
+		level->SpawnActor<ABenchActor>()->Randomise(i);
+	for (AActor* actor : level->GetActiveActors())
+		actor->UpdateRole(&host);
+
+	// First update assigns ids and is sent as new objects over TCP, so skip past it
+	host.Prepare();
+	host.Finish();
+
+	// Record the stream the host would send (Moving every actor between updates)
+	std::vector<ByteBuffer> updates(LOOPBACK_UPDATE_COUNT);
+	for (uint32 i = 0; i < LOOPBACK_UPDATE_COUNT; ++i)
+	{
+		uint32 seed = i;
+		for (ABenchActor* actor : level->GetActiveActors<ABenchActor>())
+			actor->Randomise(seed++);
+
+		host.Prepare();
+		Encode<uint32>(updates[i], i);
+		host.Encode(updates[i]);
+		host.Finish();
+	}
+
+	for (AActor* actor : level->GetActiveActors())
+		actor->UpdateRole(&remote);
+
+
+	NetLoopbackSettings ideal;
+	RunLoopbackStream(remote, updates, "(Ideal)", ideal);
+
+	NetLoopbackSettings broadband;
+	broadband.latency = 0.03f;
+	broadband.jitter = 0.01f;
+	broadband.lossRate = 0.01f;
+	broadband.seed = 1;
+	RunLoopbackStream(remote, updates, "(30ms, 10ms jitter, 1% loss)", broadband);
+
+	NetLoopbackSettings poor;
+	poor.latency = 0.1f;
+	poor.jitter = 0.05f;
+	poor.lossRate = 0.1f;
+	poor.seed = 1;
+	RunLoopbackStream(remote, updates, "(100ms, 50ms jitter, 10% loss)", poor);
+
+	NetLoopbackSettings limited;
+	limited.latency = 0.03f;
+	limited.bandwidth = 96 * 1024;
+	limited.seed = 1;
+	RunLoopbackStream(remote, updates, "(30ms, 96 KB/s)", limited);
+
+	RunLoopbackSession("(Ideal)", ideal);
+	RunLoopbackSession("(30ms, 10ms jitter, 1% loss)", broadband);
+}
+
+
+void RunNetUpdateBenchmarks()
+{
+	// Game expects an engine to fetch the (Empty) session from
+	std::vector<string> args;
+	Engine engine(args);
+
+	Game game("Benchmark", Version(1, 0, 0));
+	game.RegisterClass(ABenchActor::StaticClass());
+	game.RegisterClass(LBenchLevel::StaticClass());
+	game.defaultLevel = LBenchLevel::StaticClass();
+	game.OnGameHooked(&engine);
+	game.MainUpdate(0.0f);
+
+	BenchSession host(&game, true);
+	BenchSession remote(&game, false);
+
+	uint32 spawnedCount = 0;
+	RunWorldSize(game, host, remote, spawnedCount, 10);
+	RunWorldSize(game, host, remote, spawnedCount, 100);
+	RunWorldSize(game, host, remote, spawnedCount, 1000);
+}
@@ -0,0 +1,157 @@
+#include "Benchmark.h"
+#include "Core/ImageKernels.h"
+
+#include <vector>
+#include <cstring>
+
+
+/**
+* Pack a colour in the same order as PaletteEntry::Pack
+* (Benchmarks only link Engine-Core, so sf::Color's out of line members aren't available)
+*/
+static inline uint32 PackRGBA(const uint8& r, const uint8& g, const uint8& b, const uint8& a = 255)
+{
+	return (uint32)r | ((uint32)g << 8) | ((uint32)b << 16) | ((uint32)a << 24);
+}
+
+/**
+* Multiply two packed colours per component (Matches sf::Color's operator*)
+*/
+static inline uint32 Modulate(const uint32& a, const uint32& b)
+{
+	uint32 out = 0;
+	for (uint32 shift = 0; shift < 32; shift += 8)
+		out |= ((((a >> shift) & 0xFF) * ((b >> shift) & 0xFF)) / 255) << shift;
+	return out;
+}
+
+
+/// Greys that player sprites are drawn with, which get replaced by the player's colour
+static const uint32 lightGrey = PackRGBA(170, 170, 170);
+static const uint32 darkGrey = PackRGBA(127, 127, 127);
+
+
+/**
+* Port of the previous CastColour over a raw buffer
+* Walks column-major, reading and writing one pixel at a time, and has to be run once per grey
+* (The original also paid for an sf::Image::getPixel/setPixel call per pixel, so was slower still)
+*/
+static void LegacyCastColour(uint8* pixels, const uint32& width, const uint32& height, const uint32& toColour)
+{
+	for (uint32 x = 0; x < width; ++x)
+		for (uint32 y = 0; y < height; ++y)
+		{
+			uint8* p = pixels + (y * width + x) * 4;
+			const uint32 pc = PackRGBA(p[0], p[1], p[2], p[3]);
+			if (pc == lightGrey || pc == darkGrey)
+			{
+				const uint32 out = Modulate(pc, toColour);
+				std::memcpy(p, &out, 4);
+			}
+		}
+}
+
+static void LegacyCastColourFromCommonGrey(uint8* pixels, const uint32& width, const uint32& height, const uint32& colour)
+{
+	LegacyCastColour(pixels, width, height, colour);
+	LegacyCastColour(pixels, width, height, colour);
+}
+
+
+/**
+* Make a sprite-like image, mostly transparent with patches of both greys
+*/
+static std::vector<uint8> MakeImage(const uint32& width, const uint32& height)
+{
+	std::vector<uint8> pixels(width * height * 4);
+	for (uint32 i = 0; i < width * height; ++i)
+	{
+		uint32 colour;
+		switch ((i * 7 + i / width) % 5)
+		{
+			case 0: colour = lightGrey; break;
+			case 1: colour = darkGrey; break;
+			case 2: colour = PackRGBA(40, 20, 10); break;
+			default: colour = 0; break; // Transparent
+		}
+		std::memcpy(&pixels[i * 4], &colour, 4);
+	}
+	return pixels;
+}
+
+
+static void RunRecolourSize(const uint32& width, const uint32& height, const uint32& iterations)
+{
+	const uint32 colour = PackRGBA(0, 162, 255);
+	PaletteEntry palette[2];
+	palette[0].from = lightGrey;
+	palette[0].to = Modulate(lightGrey, colour);
+	palette[1].from = darkGrey;
+	palette[1].to = Modulate(darkGrey, colour);
+
+	const std::vector<uint8> source = MakeImage(width, height);
+	std::vector<uint8> work(source.size());
+	const size_t pixelCount = width * height;
+
+	printf(" %ix%i (Each op includes copying the %i byte source)\n", width, height, (int)source.size());
+
+	// Make sure every version agrees with the old behaviour
+	std::vector<uint8> expected = source;
+	LegacyCastColourFromCommonGrey(expected.data(), width, height, colour);
+
+	auto verify = [&](const char* name)
+	{
+		if (std::memcmp(work.data(), expected.data(), work.size()) != 0)
+			printf("  !! %s does not match legacy output\n", name);
+	};
+
+	const double legacyNs = RunBenchmark("Legacy (column-major, two passes)", iterations,
+		[&]()
+		{
+			std::memcpy(work.data(), source.data(), source.size());
+			LegacyCastColourFromCommonGrey(work.data(), width, height, colour);
+			KeepResult(work[0]);
+		}
+	);
+
+	struct Kernel
+	{
+		const char* name;
+		bool bIsSupported;
+		void(*func)(uint8*, const size_t&, const PaletteEntry*, const uint32&);
+	};
+	const Kernel kernels[] =
+	{
+		{ "ImageKernels::RecolourScalar", true, &ImageKernels::RecolourScalar },
+		{ "ImageKernels::RecolourSSE2", ImageKernels::SupportsSSE2(), &ImageKernels::RecolourSSE2 },
+		{ "ImageKernels::RecolourAVX2", ImageKernels::SupportsAVX2(), &ImageKernels::RecolourAVX2 },
+	};
+
+	for (const Kernel& kernel : kernels)
+	{
+		if (!kernel.bIsSupported)
+		{
+			printf("  %-52s %14s\n", kernel.name, "unsupported");
+			continue;
+		}
+
+		const double ns = RunBenchmark(kernel.name, iterations,
+			[&]()
+			{
+				std::memcpy(work.data(), source.data(), source.size());
+				kernel.func(work.data(), pixelCount, palette, 2);
+				KeepResult(work[0]);
+			}
+		);
+		verify(kernel.name);
+		printf("  %-52s %13.2fx\n", "  speedup vs legacy", legacyNs / ns);
+	}
+}
+
+void RunRecolourBenchmarks()
+{
+	// Character frame size, then a full atlas page
+	RunRecolourSize(16, 21, 200000);
+	RunRecolourSize(256, 256, 2000);
+	RunRecolourSize(1024, 1024, 100);
+}
@@ -1,5 +1,5 @@
 #pragma once
-#include "Core\Core-Common.h"
+#include "Core/Core-Common.h"
 
 #include "BPlayerController.h"
 
@@ -7,7 +7,7 @@
 #include <fstream>
 #include <functional>
 #include <queue>
-#include <SFML\Network.hpp>
+#include <SFML/Network.hpp>
 
 
 
@@ -22,7 +22,7 @@ typedef std::function<void(Http::Response&)> HttpCallback;
 */
 class OAPIController : public OObject
 {
-	CLASS_BODY()
+	CLASS_BODY(OObject)
 private:
 	///
 	/// API information
@@ -1,6 +1,7 @@
 #pragma once
-#include "Core\Core-Common.h"
+#include "Core/Core-Common.h"
 #include "APIController.h"
+#include <map>
 
 
 /**
@@ -8,7 +9,7 @@
 */
 class APINetLayer : public DefaultNetLayer
 {
-	CLASS_BODY()
+	CLASS_BODY(DefaultNetLayer)
 private:
 	enum UserCheckState : uint8
 	{
@@ -1,6 +1,7 @@
 #include "BBomb.h"
 #include "BLevelArena.h"
 #include "BCharacter.h"
+#include <cmath>
 
 
 CLASS_SOURCE(ABBomb)
@@ -74,13 +75,9 @@ void ABBomb::RegisterAssets(Game* game)
 				subimage.create(frameSize, frameSize, sf::Color(1, 1, 1));
 				uint32 x = i;
 				uint32 y = 0;
-				subimage.copy(atlas, 0, 0, sf::IntRect::Rect(x * frameSize, y * frameSize, frameSize, frameSize), false);
+				subimage.copy(atlas, 0, 0, sf::IntRect(x * frameSize, y * frameSize, frameSize, frameSize), false);
 
-				sf::Texture* texture = new sf::Texture;
-				texture->loadFromImage(subimage);
-				texture->setRepeated(true);
-				texture->setSmooth(false);
-				assets->RegisterTexture("Resources\\Items\\" + skin + "_Bomb.png." + std::to_string(i), texture);
+				assets->RegisterAtlasTexture("Resources\\Items\\" + skin + "_Bomb.png." + std::to_string(i), subimage);
 			}
 		}
 		
@@ -88,8 +85,8 @@ void ABBomb::RegisterAssets(Game* game)
 		// Setup animation
 		AnimationSheet* anim = new AnimationSheet;
 		anim->SetFrameDuration(0.05f);
-		anim->AddFrame(game->GetAssetController()->GetTexture("Resources\\Items\\" + skin + "_Bomb.png.0"));
-		anim->AddFrame(game->GetAssetController()->GetTexture("Resources\\Items\\" + skin + "_Bomb.png.1"));
+		anim->AddFrame(game->GetAssetController()->GetTextureRegion("Resources\\Items\\" + skin + "_Bomb.png.0"));
+		anim->AddFrame(game->GetAssetController()->GetTextureRegion("Resources\\Items\\" + skin + "_Bomb.png.1"));
 		assets->RegisterAnimation("Resources\\Items\\" + skin + "_Bomb.anim", anim);
 	}
 #endif
@@ -98,7 +95,7 @@ void ABBomb::RegisterAssets(Game* game)
 void ABBomb::OnBegin() 
 {
 	Super::OnBegin();
-	m_animation = GetAssetController()->GetAnimation("Resources\\Items\\Default_Bomb.anim");
+	m_animation.sheet = GetAssetController()->GetAnimation("Resources\\Items\\Default_Bomb.anim");
 }
 
 void ABBomb::OnTick(const float& deltaTime) 
@@ -137,7 +134,7 @@ void ABBomb::OnTick(const float& deltaTime)
 }
 
 #ifdef BUILD_CLIENT
-void ABBomb::OnDraw(sf::RenderWindow* window, const float& deltaTime) 
+void ABBomb::OnRender(RenderSnapshot& snapshot) 
 {
 
 	// Draw pulsing bomb (Only draw if not exploding)
@@ -151,21 +148,16 @@ void ABBomb::OnDraw(sf::RenderWindow* window, const float& deltaTime)
 
 		const vec2 pulseSize = vec2(pulseScale, pulseScale) * std::abs(std::sin(t * 3.141592f * pulseFrequency));
 
-		sf::RectangleShape rect;
-		rect.setPosition(GetLocation() + m_drawOffset - pulseSize * 0.5f);
-		rect.setSize(m_drawSize + pulseSize);
-
-		if (m_animation != nullptr)
-			rect.setTexture(m_animation->GetCurrentFrame());
-
+		const TextureRegion texture = m_animation.GetFrame(GetAssetController()->GetAnimationTime());
 
 		// Blur to grey when close to explosion
+		Colour colour = Colour::White;
 		if (t < 0.05f)
 		{
 			const uint8 v = (uint8)((t / 0.05f) * 255);
-			rect.setFillColor(sf::Color(v,v,v));
+			colour = sf::Color(v,v,v);
 		}
-		window->draw(rect);
+		snapshot.AddQuad(GetDrawingLayer(), GetLocation() + m_drawOffset - pulseSize * 0.5f, m_drawSize + pulseSize, texture, colour);
 	}
 
 }
@@ -210,4 +202,5 @@ void ABBomb::SyncAnimation()
 	bHasExploded = false;
 	m_explodeTimer = m_explodeLength;
 	m_damageTimer = m_damageLength;
+	m_animation.Play(GetAssetController()->GetAnimationTime());
 }
\ No newline at end of file
@@ -4,7 +4,7 @@
 
 class ABBomb : public ABTileableActor
 {
-	CLASS_BODY()
+	CLASS_BODY(ABTileableActor)
 private:
 	friend class ABCharacter;
 	friend class ABLevelArena;
@@ -12,7 +12,7 @@ private:
 
 	const vec2 m_drawSize;
 	const vec2 m_drawOffset;
-	const AnimationSheet* m_animation = nullptr;
+	AnimationPlayback m_animation;
 
 	/// How long until this explodes
 	float m_explodeTimer;
@@ -45,7 +45,7 @@ public:
 	virtual void OnTick(const float& deltaTime) override;
 	//virtual void OnTick(const float& deltaTime) override;
 #ifdef BUILD_CLIENT
-	virtual void OnDraw(sf::RenderWindow* window, const float& deltaTime) override;
+	virtual void OnRender(RenderSnapshot& snapshot) override;
 #endif
 
 
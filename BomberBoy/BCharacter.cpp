@@ -1,6 +1,6 @@
 #include "BCharacter.h"
 #include "BLevelArena.h"
-#include "Utils.h"
+#include "Core/ImageKernels.h"
 
 #include "BPlayerController.h"
 #include "BLevelController.h"
@@ -8,6 +8,7 @@
 
 CLASS_SOURCE(ABCharacter)
 const uint32 ABCharacter::s_maxBombCount = 10;
+AnimationID ABCharacter::s_animations[4];
 
 
 ABCharacter::ABCharacter() :
@@ -90,58 +91,46 @@ void ABCharacter::RegisterAssets(Game* game)
 
 
 	// Import all player directions (And setup animations)
-	for (const string& dir : directions)
+	// Player colours are applied when drawn, by tinting a greyscale mask over the frame, so every colour shares these
+	for (uint32 d = 0; d < 4; ++d)
 	{
+		const string& dir = directions[d];
+		TextureID frames[3];
+		TextureID masks[3];
+
 		// Register textures
 		for (uint32 i = 0; i < 3; ++i)
 		{
-			// Import default (Grey character)
-			const string defaultPath = "Resources\\Character\\" + dir + "_" + std::to_string(i) + ".png";
-			assets->RegisterTexture(defaultPath, false);
-
-			// Register player/team colours
-			// Asset gets registerd at path (Where path is xyz.png) xyz.png.<colour rgb value as string>
-			for (const Colour& colour : OBPlayerController::s_supportedColours)
-			{
-				// Get texture in desired colour
-				sf::Texture* texture = new sf::Texture;
-				texture->setSmooth(false);
-				texture->setRepeated(false);
-
-				sf::Image image;
-				image.loadFromFile(defaultPath);
-				CastColourFromCommonGrey(image, colour);
-				texture->loadFromImage(image);
-
-				const string colourName = std::to_string(colour.r) + std::to_string(colour.g) + std::to_string(colour.b);
-				assets->RegisterTexture(defaultPath + "." + colourName, texture);
-			}
+			// Asset gets registered at path xyz.png with its mask at xyz.png.mask
+			const string path = "Resources\\Character\\" + dir + "_" + std::to_string(i) + ".png";
+			sf::Image image;
+			if (!image.loadFromFile(path))
+				continue;
+
+			// Split the common greys out into the mask (Drawing it tinted over the base gives the coloured frame)
+			const uint32 greys[] = { PaletteEntry::Pack(Colour(170, 170, 170)), PaletteEntry::Pack(Colour(127, 127, 127)) };
+			const sf::Vector2u size = image.getSize();
+			std::vector<uint8> basePixels(size.x * size.y * 4);
+			std::vector<uint8> maskPixels(size.x * size.y * 4);
+			ImageKernels::SplitMask(image.getPixelsPtr(), size.x * size.y, greys, 2, basePixels.data(), maskPixels.data());
+
+			sf::Image base;
+			sf::Image mask;
+			base.create(size.x, size.y, basePixels.data());
+			mask.create(size.x, size.y, maskPixels.data());
+			frames[i] = assets->RegisterAtlasTexture(path, base);
+			masks[i] = assets->RegisterAtlasTexture(path + ".mask", mask);
 		}
 
 
 		// Setup animation
-		// Default (grey)
 		AnimationSheet* anim = new AnimationSheet;
 		anim->SetFrameDuration(0.15f);
-		anim->AddFrame(game->GetAssetController()->GetTexture("Resources\\Character\\" + dir + "_0.png"));
-		anim->AddFrame(game->GetAssetController()->GetTexture("Resources\\Character\\" + dir + "_1.png"));
-		anim->AddFrame(game->GetAssetController()->GetTexture("Resources\\Character\\" + dir + "_0.png"));
-		anim->AddFrame(game->GetAssetController()->GetTexture("Resources\\Character\\" + dir + "_2.png"));
-		assets->RegisterAnimation("Resources\\Character\\" + dir + ".anim", anim);
-
-		// Register player/team colours
-		// Asset gets registerd at path (Where path is xyz.anim) xyz.anim.<colour name>
-		for (const Colour& colour : OBPlayerController::s_supportedColours)
-		{
-			const string colourName = std::to_string(colour.r) + std::to_string(colour.g) + std::to_string(colour.b);
-			AnimationSheet* colAnim = new AnimationSheet;
-			colAnim->SetFrameDuration(0.15f);
-			colAnim->AddFrame(game->GetAssetController()->GetTexture("Resources\\Character\\" + dir + "_0.png." + colourName));
-			colAnim->AddFrame(game->GetAssetController()->GetTexture("Resources\\Character\\" + dir + "_1.png." + colourName));
-			colAnim->AddFrame(game->GetAssetController()->GetTexture("Resources\\Character\\" + dir + "_0.png." + colourName));
-			colAnim->AddFrame(game->GetAssetController()->GetTexture("Resources\\Character\\" + dir + "_2.png." + colourName));
-			assets->RegisterAnimation("Resources\\Character\\" + dir + ".anim." + colourName, colAnim);
-		}
+		anim->AddFrame(assets->GetTextureRegion(frames[0]), assets->GetTextureRegion(masks[0]));
+		anim->AddFrame(assets->GetTextureRegion(frames[1]), assets->GetTextureRegion(masks[1]));
+		anim->AddFrame(assets->GetTextureRegion(frames[0]), assets->GetTextureRegion(masks[0]));
+		anim->AddFrame(assets->GetTextureRegion(frames[2]), assets->GetTextureRegion(masks[2]));
+		s_animations[d] = assets->RegisterAnimation("Resources\\Character\\" + dir + ".anim", anim);
 	}
 #endif
 }
@@ -205,15 +194,20 @@ void ABCharacter::OnTick(const float& deltaTime)
 			AttemptMove(Direction::Right);
 
 		if (m_bombKey.IsHeld())
-			CallRPC_OneParam(this, PlaceBomb, GetClosestTileLocation());
+			RequestBomb();
 
 
+#ifdef BUILD_CLIENT
 		// Move camera
-		const vec2 diff = m_camera->GetLocation() - GetLocation();
-		const float sqrdDist = diff.x*diff.x + diff.y*diff.y;
+		if (m_camera != nullptr)
+		{
+			const vec2 diff = m_camera->GetLocation() - GetLocation();
+			const float sqrdDist = diff.x*diff.x + diff.y*diff.y;
 
-		if (sqrdDist >= 100.0f * 100.0f)
-			m_camera->SetLocation(m_camera->GetLocation() * 0.99f + GetLocation() * 0.01f);
+			if (sqrdDist >= 100.0f * 100.0f)
+				m_camera->SetLocation(m_camera->GetLocation() * 0.99f + GetLocation() * 0.01f);
+		}
+#endif
 	}
 
 	// Check to see if dead or not
@@ -231,7 +225,7 @@ void ABCharacter::OnTick(const float& deltaTime)
 }
 
 #ifdef BUILD_CLIENT
-void ABCharacter::OnDraw(sf::RenderWindow* window, const float& deltaTime) 
+void ABCharacter::OnRender(RenderSnapshot& snapshot) 
 {
 	const Direction& direction = GetDirection();
 	const AnimationSheet* anim =
@@ -240,17 +234,21 @@ void ABCharacter::OnDraw(sf::RenderWindow* window, const float& deltaTime)
 		direction == Direction::Left ? m_animLeft :
 		m_animRight;
 
-	sf::RectangleShape rect;
-	rect.setPosition(GetLocation() + m_drawOffset);
-	rect.setSize(m_drawSize);
-	if (anim != nullptr)
-	{
-		if(IsMoving())
-			rect.setTexture(anim->GetCurrentFrame());
-		else
-			rect.setTexture(anim->GetFrame(0));
-	}
-	window->draw(rect);
+	// Restart the walk cycle each time movement starts (Turning carries on from the same frame)
+	m_walkAnimation.sheet = anim;
+	if (!IsMoving())
+		m_walkAnimation.Stop();
+	else if (!m_walkAnimation.bIsPlaying)
+		m_walkAnimation.Play(GetAssetController()->GetAnimationTime());
+
+	const float time = GetAssetController()->GetAnimationTime();
+	const TextureRegion texture = m_walkAnimation.GetFrame(time);
+	const TextureRegion mask = m_walkAnimation.GetMask(time);
+	snapshot.AddQuad(GetDrawingLayer(), GetLocation() + m_drawOffset, m_drawSize, texture);
+
+	// Tint in player's colour
+	if (mask.IsValid())
+		snapshot.AddQuad(GetDrawingLayer(), GetLocation() + m_drawOffset, m_drawSize, mask, m_tint);
 }
 #endif
 
@@ -261,6 +259,11 @@ void ABCharacter::PlaceBomb(const ivec2& tile)
 		++m_bombsPlaced;
 }
 
+void ABCharacter::RequestBomb()
+{
+	CallRPC_OneParam(this, PlaceBomb, GetClosestTileLocation());
+}
+
 void ABCharacter::SetColour(const uint16& colourIndex)
 {
 	if (m_colourIndex != colourIndex)
@@ -273,14 +276,16 @@ void ABCharacter::SetColour(const uint16& colourIndex)
 void ABCharacter::OnChange_ColourIndex()
 {
 #ifdef BUILD_CLIENT
-	const Colour colour = OBPlayerController::s_supportedColours[m_colourIndex];
-	const string colourName = std::to_string(colour.r) + std::to_string(colour.g) + std::to_string(colour.b);
-
-	// Load default animations
-	m_animUp = GetGame()->GetAssetController()->GetAnimation("Resources\\Character\\Up.anim." + colourName);
-	m_animDown = GetGame()->GetAssetController()->GetAnimation("Resources\\Character\\Down.anim." + colourName);
-	m_animLeft = GetGame()->GetAssetController()->GetAnimation("Resources\\Character\\Left.anim." + colourName);
-	m_animRight = GetGame()->GetAssetController()->GetAnimation("Resources\\Character\\Right.anim." + colourName);
+	const AssetController* assets = GetGame()->GetAssetController();
+
+	// Load default animations (Shared by all colours)
+	m_animUp = assets->GetAnimation(GetAnimationID(Direction::Up));
+	m_animDown = assets->GetAnimation(GetAnimationID(Direction::Down));
+	m_animLeft = assets->GetAnimation(GetAnimationID(Direction::Left));
+	m_animRight = assets->GetAnimation(GetAnimationID(Direction::Right));
+
+	// 16 is unassigned (Its black entry is only for HUD), so leave the greys untinted until a colour is given
+	m_tint = m_colourIndex < 16 ? OBPlayerController::s_supportedColours[m_colourIndex] : Colour::White;
 #endif
 }
 
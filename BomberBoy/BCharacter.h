@@ -1,8 +1,8 @@
 #pragma once
-#include "Core\Core-Common.h"
+#include "Core/Core-Common.h"
 #include "BTileableActor.h"
 
-#include "Core\Camera.h"
+#include "Core/Camera.h"
 #include "BBomb.h"
 
 
@@ -12,12 +12,15 @@
 */
 class ABCharacter : public ABTileableActor
 {
-	CLASS_BODY()
+	CLASS_BODY(ABTileableActor)
 	friend class ABMatchController;
 public:
 	static const uint32 s_maxBombCount;
 
 private:
+	/// Animation for each direction, resolved during RegisterAssets
+	static AnimationID s_animations[4];
+
 	///
 	/// Score vars
 	///
@@ -32,16 +35,20 @@ private:
 	/// Visual vars
 	///
 	uint16 m_colourIndex = 16;
+#ifdef BUILD_CLIENT
+	Colour m_tint = Colour::White;
+#endif
 	const AnimationSheet* m_animUp = nullptr;
 	const AnimationSheet* m_animDown = nullptr;
 	const AnimationSheet* m_animLeft = nullptr;
 	const AnimationSheet* m_animRight = nullptr;
+	AnimationPlayback m_walkAnimation;
 
 	///
 	/// Control vars
 	///
 	class OBPlayerController* m_playerController = nullptr;
-	ACamera* m_camera;
+	ACamera* m_camera = nullptr;
 	const vec2 m_drawSize;
 	const vec2 m_drawOffset;
 
@@ -79,10 +86,17 @@ public:
 	*/
 	static void RegisterAssets(Game* game);
 
+	/**
+	* Get the animation for a direction (Frames are grey, with a mask to be tinted in the player's colour)
+	* @param direction			The direction the character is facing
+	* @returns The id of the animation or an invalid id, if it doesn't exist
+	*/
+	static inline AnimationID GetAnimationID(const Direction& direction) { return s_animations[direction]; }
+
 
 	virtual void OnTick(const float& deltaTime) override;
 #ifdef BUILD_CLIENT
-	virtual void OnDraw(sf::RenderWindow* window, const float& deltaTime) override;
+	virtual void OnRender(RenderSnapshot& snapshot) override;
 #endif
 
 	/**
@@ -91,6 +105,12 @@ public:
 	*/
 	void PlaceBomb(const ivec2& tile);
 
+	/**
+	* Ask the host to place a bomb at the tile closest to this player
+	* (Only callable by owner)
+	*/
+	void RequestBomb();
+
 	/**
 	* Update the character's animations to make sure the colours are correct
 	* @param colourIndex			The index to use as a colour
@@ -1,8 +1,10 @@
 #include "BGameLevelBase.h"
 
-#include "Core\Camera.h"
+#include "Core/Camera.h"
 #include "BLevelController.h"
+#ifdef BUILD_CLIENT
 #include "GamemodeHUD.h"
+#endif
 
 CLASS_SOURCE(LBGameLevelBase)
 
@@ -10,7 +12,9 @@ CLASS_SOURCE(LBGameLevelBase)
 LBGameLevelBase::LBGameLevelBase()
 {
 	levelControllerClass = ABMatchController::StaticClass();
+#ifdef BUILD_CLIENT
 	hudClass = AGamemodeHUD::StaticClass();
+#endif
 }
 
 void LBGameLevelBase::OnBuildLevel() 
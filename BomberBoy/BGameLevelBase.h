@@ -1,5 +1,5 @@
 #pragma once
-#include "Core\Core-Common.h"
+#include "Core/Core-Common.h"
 
 #include "BLevelArena.h"
 
@@ -9,7 +9,7 @@
 */
 class LBGameLevelBase : public LLevel
 {
-	CLASS_BODY()	
+	CLASS_BODY(LLevel)	
 
 public:
 	LBGameLevelBase();
@@ -9,20 +9,34 @@ static const string tileSetNames[]
 	"Default"
 };
 
+#ifdef BUILD_CLIENT
+/// Atlas for each tile set, resolved during RegisterAssets
+static std::vector<TextureID> tileSetAtlases;
+
+/// Every tile is drawn as a background quad and an overlay quad
+static const uint32 verticesPerTile = 8;
+
+/// Layout of the cells in a tile set's atlas
+static const uint32 atlasColumns = 4;
+static const uint32 atlasRows = 5;
+enum AtlasCell : int32
+{
+	FloorCell = 0,
+	BoxCell,
+	LootCell,
+	SolidCell,	// Plain white, for tinting
+	WallCell	// Followed by the other 15 wall combinations
+};
+#endif
+
 
 ABLevelArena::ABLevelArena() : 
 	m_tileSize(vec2(42.0f, 42.0f)),
-	m_arenaSize(10, 10), 
-
-	m_currentWallTiles({nullptr})
+	m_arenaSize(10, 10)
 {
 	m_drawingLayer = 1;
 	bIsNetSynced = true;
 
-	m_currentFloorTile = nullptr;
-	m_currentBoxTile = nullptr;
-	m_currentLootTile = nullptr;
-
 	m_tiles.reserve(2000);
 	m_tiles.resize(m_arenaSize.x * m_arenaSize.y, TileType::Floor);
 	m_explosionParents.resize(m_arenaSize.x * m_arenaSize.y, nullptr);
@@ -52,35 +66,41 @@ void ABLevelArena::RegisterAssets(Game* game)
 #ifdef BUILD_CLIENT
 
 	// Import all tilesets
+	// Every tile is packed into a single atlas, so the whole arena can be drawn in one call
+	tileSetAtlases.clear();
 	for (const string& name : tileSetNames)
 	{
-		assets->RegisterTexture("Resources\\Level\\" + name + "_Box.png", false, true);
-		assets->RegisterTexture("Resources\\Level\\" + name + "_Loot.png", false, true);
-		assets->RegisterTexture("Resources\\Level\\" + name + "_Floor.png", false, true);
+		sf::Image floor;
+		sf::Image box;
+		sf::Image loot;
+		sf::Image walls;
+		floor.loadFromFile("Resources\\Level\\" + name + "_Floor.png");
+		box.loadFromFile("Resources\\Level\\" + name + "_Box.png");
+		loot.loadFromFile("Resources\\Level\\" + name + "_Loot.png");
+		walls.loadFromFile("Resources\\Level\\" + name + "_Walls.png");
 
 		// Wall tiles are stored in an atlas
 		// -Combinations are stored in binary order where 0000 means no wall tiles adjacent
 		// -Right most digit refers to top wall tile then goes clockwise e.g. 1010 Means: Top empty, Right wall, Bottom empty, left wall
+		const uint32 tileWidth = walls.getSize().x / 4;
+		const uint32 tileHeight = walls.getSize().y / 4;
 
-		// Stored as <name>_Walls.png.<num> when num is the decimal representation of the nibble
 		sf::Image atlas;
-		atlas.loadFromFile("Resources\\Level\\" + name + "_Walls.png");
-		const uint32 tileWidth = atlas.getSize().x / 4;
-		const uint32 tileHeight = atlas.getSize().y / 4;
+		atlas.create(tileWidth * atlasColumns, tileHeight * atlasRows, sf::Color::White);
+		atlas.copy(floor, (AtlasCell::FloorCell % atlasColumns) * tileWidth, (AtlasCell::FloorCell / atlasColumns) * tileHeight, sf::IntRect(0, 0, tileWidth, tileHeight));
+		atlas.copy(box, (AtlasCell::BoxCell % atlasColumns) * tileWidth, (AtlasCell::BoxCell / atlasColumns) * tileHeight, sf::IntRect(0, 0, tileWidth, tileHeight));
+		atlas.copy(loot, (AtlasCell::LootCell % atlasColumns) * tileWidth, (AtlasCell::LootCell / atlasColumns) * tileHeight, sf::IntRect(0, 0, tileWidth, tileHeight));
+
 		for (uint32 i = 0; i < 16; ++i)
 		{
-			sf::Image subimage;
-			subimage.create(tileWidth, tileHeight, sf::Color(1, 1, 1));
-			uint32 x = i % 4;
-			uint32 y = i / 4;
-			subimage.copy(atlas, 0, 0, sf::IntRect::Rect(x * tileWidth, y * tileHeight, tileWidth, tileHeight), true);
-
-			sf::Texture* texture = new sf::Texture;
-			texture->loadFromImage(subimage);
-			texture->setRepeated(true);
-			texture->setSmooth(false);
-			assets->RegisterTexture("Resources\\Level\\" + name + "_Walls.png." + std::to_string(i), texture);
+			const uint32 cell = AtlasCell::WallCell + i;
+			atlas.copy(walls, (cell % atlasColumns) * tileWidth, (cell / atlasColumns) * tileHeight, sf::IntRect((i % 4) * tileWidth, (i / 4) * tileHeight, tileWidth, tileHeight));
 		}
+
+		sf::Texture* texture = new sf::Texture;
+		texture->loadFromImage(atlas);
+		texture->setSmooth(false);
+		tileSetAtlases.emplace_back(assets->RegisterTexture("Resources\\Level\\" + name + "_Atlas", texture));
 	}
 
 #endif
@@ -95,93 +115,139 @@ void ABLevelArena::OnBegin()
 
 
 #ifdef BUILD_CLIENT
-void ABLevelArena::OnDraw(sf::RenderWindow* window, const float& deltaTime) 
+void ABLevelArena::OnRender(RenderSnapshot& snapshot) 
 {
-	const vec2 viewCentre = window->getView().getCenter();
-	const vec2 viewHalfSize = window->getView().getSize() * 0.5f;
+	UpdateTileMesh();
+	if (m_tileMesh)
+		snapshot.AddMesh(GetDrawingLayer(), GetLocation(), m_tileMesh, m_tileAtlas);
+}
 
-	const vec2 min = viewCentre - viewHalfSize;
-	const vec2 max = viewCentre + viewHalfSize;
+void ABLevelArena::UpdateTileMesh()
+{
+	const uint32 tileCount = m_arenaSize.x * m_arenaSize.y;
 
+	// Arena has been resized or tile set changed, so rebuild everything
+	if (m_tileMesh == nullptr || m_meshTiles.size() != m_tiles.size() || m_tileMesh->getVertexCount() != tileCount * verticesPerTile)
+	{
+		m_tileMesh = std::make_shared<sf::VertexArray>(sf::Quads, tileCount * verticesPerTile);
 
-	for (int x = 0; x < m_arenaSize.x; ++x)
-		for (int y = 0; y < m_arenaSize.y; ++y)
-		{
-			if (!bIsDrawSafe)
-				return;
+		for (uint32 x = 0; x < m_arenaSize.x; ++x)
+			for (uint32 y = 0; y < m_arenaSize.y; ++y)
+				WriteTileQuads(*m_tileMesh, x, y);
 
-			const TileType tile = GetTile(x, y);
-			const vec2 location = GetLocation() + vec2((x)* m_tileSize.x, (y)* m_tileSize.y);
+		m_meshTiles = m_tiles;
+		return;
+	}
 
-			// Cull shapes off screen
-			if (location.x + m_tileSize.x < min.x || location.y + m_tileSize.y < min.y || location.x - m_tileSize.x > max.x || location.y - m_tileSize.y > max.y)
+	bool bHasCopied = false;
+	for (uint32 x = 0; x < m_arenaSize.x; ++x)
+		for (uint32 y = 0; y < m_arenaSize.y; ++y)
+		{
+			const uint32 index = GetTileIndex(x, y);
+			if (m_meshTiles[index] == m_tiles[index])
 				continue;
 
-			sf::RectangleShape tileRect;
-			tileRect.setPosition(location); // Draw from centre of tile
-			tileRect.setSize(m_tileSize);
-			
-
-			// Draw special tiles
-			switch (tile)
+			// Snapshots may still be drawing the old mesh, so take a copy to edit
+			if (!bHasCopied)
 			{
-				case TileType::Floor:
-					tileRect.setTexture(m_currentFloorTile);
-					window->draw(tileRect);
-					break;
-
-				case TileType::Box:
-					// Draw floor under box
-					tileRect.setTexture(m_currentFloorTile);
-					window->draw(tileRect);
-
-					tileRect.setTexture(m_currentBoxTile);
-					window->draw(tileRect);
-					break;
-
-				case TileType::LootBox:
-					// Draw floor under loot
-					tileRect.setTexture(m_currentFloorTile);
-					window->draw(tileRect);
-
-					tileRect.setTexture(m_currentLootTile);
-					window->draw(tileRect);
-					break;
-
-				case TileType::Bomb:
-					// Actor will draw itself, but will still need the floor to be there
-					tileRect.setTexture(m_currentFloorTile);
-					window->draw(tileRect);
-					break;
-
-				case TileType::Explosion:
-					// TODO - Draw explosion
-					tileRect.setFillColor(sf::Color::Red);
-					window->draw(tileRect);
-					break;
-
-				case TileType::Wall:
-					uint32 tileId = 0;
-					if (GetTile(x, y - 1) == TileType::Wall)
-						tileId |= 1;
-					if (GetTile(x + 1, y) == TileType::Wall)
-						tileId |= 2;
-					if (GetTile(x, y + 1) == TileType::Wall)
-						tileId |= 4;
-					if (GetTile(x - 1, y) == TileType::Wall)
-						tileId |= 8;
-
-					tileRect.setTexture(m_currentWallTiles[tileId]);
-					window->draw(tileRect);
-					break;
+				if (m_tileMesh.use_count() != 1)
+					m_tileMesh = std::make_shared<sf::VertexArray>(*m_tileMesh);
+				bHasCopied = true;
 			}
+
+			// Neighbouring walls need to change their edges too
+			WriteTileQuads(*m_tileMesh, x, y);
+			if (x != 0)
+				WriteTileQuads(*m_tileMesh, x - 1, y);
+			if (x + 1 < m_arenaSize.x)
+				WriteTileQuads(*m_tileMesh, x + 1, y);
+			if (y != 0)
+				WriteTileQuads(*m_tileMesh, x, y - 1);
+			if (y + 1 < m_arenaSize.y)
+				WriteTileQuads(*m_tileMesh, x, y + 1);
 		}
+
+	if (bHasCopied)
+		m_meshTiles = m_tiles;
+}
+
+void ABLevelArena::WriteTileQuads(sf::VertexArray& mesh, const uint32& x, const uint32& y)
+{
+	const vec2 location(x * m_tileSize.x, y * m_tileSize.y);
+	sf::Vertex* vertices = &mesh[GetTileIndex(x, y) * verticesPerTile];
+
+	// Fill in quad to cover this tile using this atlas cell (or collapse it, if there is no cell)
+	auto writeQuad =
+	[this, &location](sf::Vertex* quad, const int32& cell, const sf::Color& colour)
+	{
+		if (cell < 0)
+		{
+			for (uint32 i = 0; i < 4; ++i)
+				quad[i] = sf::Vertex(location, sf::Color::Transparent);
+			return;
+		}
+
+		const vec2 cellSize(m_tileAtlas == nullptr ? 0.0f : m_tileAtlas->getSize().x / atlasColumns, m_tileAtlas == nullptr ? 0.0f : m_tileAtlas->getSize().y / atlasRows);
+		const vec2 texCoord((cell % atlasColumns) * cellSize.x, (cell / atlasColumns) * cellSize.y);
+
+		quad[0] = sf::Vertex(location, colour, texCoord);
+		quad[1] = sf::Vertex(location + vec2(m_tileSize.x, 0), colour, texCoord + vec2(cellSize.x, 0));
+		quad[2] = sf::Vertex(location + m_tileSize, colour, texCoord + cellSize);
+		quad[3] = sf::Vertex(location + vec2(0, m_tileSize.y), colour, texCoord + vec2(0, cellSize.y));
+	};
+
+
+	int32 background = -1;
+	int32 foreground = -1;
+	sf::Color colour = sf::Color::White;
+
+	switch (GetTile(x, y))
+	{
+		case TileType::Floor:
+		case TileType::Bomb: // Actor will draw itself, but will still need the floor to be there
+			background = AtlasCell::FloorCell;
+			break;
+
+		case TileType::Box:
+			background = AtlasCell::FloorCell;
+			foreground = AtlasCell::BoxCell;
+			break;
+
+		case TileType::LootBox:
+			background = AtlasCell::FloorCell;
+			foreground = AtlasCell::LootCell;
+			break;
+
+		case TileType::Explosion:
+			// TODO - Draw explosion
+			background = AtlasCell::SolidCell;
+			colour = sf::Color::Red;
+			break;
+
+		case TileType::Wall:
+		{
+			uint32 tileId = 0;
+			if (GetTile(x, y - 1) == TileType::Wall)
+				tileId |= 1;
+			if (GetTile(x + 1, y) == TileType::Wall)
+				tileId |= 2;
+			if (GetTile(x, y + 1) == TileType::Wall)
+				tileId |= 4;
+			if (GetTile(x - 1, y) == TileType::Wall)
+				tileId |= 8;
+
+			background = AtlasCell::WallCell + tileId;
+			break;
+		}
+	}
+
+	writeQuad(vertices, background, colour);
+	writeQuad(vertices + 4, foreground, sf::Color::White);
 }
 #endif
 
 void ABLevelArena::ResetArena(uvec2 size)
 {
-	bIsDrawSafe = false;
 	m_tiles.clear();
 	m_tiles.resize(size.x * size.y, TileType::Floor);
 	m_arenaSize = size;
@@ -201,18 +267,15 @@ void ABLevelArena::ResetArena(uvec2 size)
 		m_spawnPoints.emplace_back(1 + i * stride, 1);
 		m_spawnPoints.emplace_back(1 + i * stride, m_arenaSize.x - 3);
 	}
-	bIsDrawSafe = true;
 }
 
 void ABLevelArena::SetTileset(const TileSet& set)
 {
 #ifdef BUILD_CLIENT
-	m_currentFloorTile = GetAssetController()->GetTexture("Resources\\Level\\" + tileSetNames[set] + "_Floor.png");
-	m_currentBoxTile = GetAssetController()->GetTexture("Resources\\Level\\" + tileSetNames[set] + "_Box.png");
-	m_currentLootTile = GetAssetController()->GetTexture("Resources\\Level\\" + tileSetNames[set] + "_Loot.png");
+	m_tileAtlas = set < tileSetAtlases.size() ? GetAssetController()->GetTextureRegion(tileSetAtlases[set]).texture : nullptr;
 
-	for (uint32 i = 0; i < 16; ++i)
-		m_currentWallTiles[i] = GetAssetController()->GetTexture("Resources\\Level\\" + tileSetNames[set] + "_Walls.png." + std::to_string(i));
+	// Texture coords are baked into the mesh, so rebuild it all
+	m_tileMesh = nullptr;
 #endif
 }
 
@@ -1,6 +1,6 @@
 #pragma once
-#include "Core\Core-Common.h"
-#include <array>
+#include "Core/Core-Common.h"
+#include <memory>
 
 
 
@@ -9,7 +9,7 @@
 */
 class ABLevelArena : public AActor
 {
-	CLASS_BODY()
+	CLASS_BODY(AActor)
 public:
 	/// Different tile sets that arenas can use
 	enum TileSet : uint8
@@ -41,18 +41,20 @@ private:
 	TileGrid m_tiles;
 	/// The default state for this arena
 	TileGrid m_defaultTiles;
-	/// Is it currently safe to draw
-	bool bIsDrawSafe = false;
 
 	/// The areas which are safe to spawn in
 	std::vector<ivec2> m_spawnPoints;
 	/// What bombs are currently affecting which tiles
 	std::vector<class ABBomb*> m_explosionParents;
 	
-	const sf::Texture* m_currentFloorTile;
-	const sf::Texture* m_currentBoxTile;
-	const sf::Texture* m_currentLootTile;
-	std::array<const sf::Texture*, 16> m_currentWallTiles;
+#ifdef BUILD_CLIENT
+	/// Atlas containing every tile for the current tile set
+	const sf::Texture* m_tileAtlas = nullptr;
+	/// Cached quads for every tile (Shared with render snapshots, so must be copied before editing, if still referenced)
+	std::shared_ptr<sf::VertexArray> m_tileMesh;
+	/// The tiles which m_tileMesh was last built from
+	TileGrid m_meshTiles;
+#endif
 
 
 public:
@@ -71,7 +73,23 @@ public:
 
 	//virtual void OnTick(const float& deltaTime) override;
 #ifdef BUILD_CLIENT
-	virtual void OnDraw(sf::RenderWindow* window, const float& deltaTime) override;
+	virtual void OnRender(RenderSnapshot& snapshot) override;
+
+private:
+	/**
+	* Bring the cached tile mesh up to date with the current tiles
+	* Only tiles which have changed (And their neighbours, for wall edges) are rewritten
+	*/
+	void UpdateTileMesh();
+
+	/**
+	* Write the quads for a single tile into a mesh
+	* @param mesh			The mesh to write to
+	* @param x				The x coord of the tile
+	* @param y				The y coord of the tile
+	*/
+	void WriteTileQuads(sf::VertexArray& mesh, const uint32& x, const uint32& y);
+public:
 #endif
 
 
@@ -3,11 +3,14 @@
 
 #include <ctime>
 #include <sstream>
+#include <algorithm>
 
 #include "LobbyLevel.h"
 #include "APIController.h"
 
+#ifdef BUILD_CLIENT
 #include "ChatWidget.h"
+#endif
 
 
 CLASS_SOURCE(ABMatchController)
@@ -317,6 +320,8 @@ void ABMatchController::OnPlayerExploded(ABCharacter* victim, ABCharacter* kille
 
 void ABMatchController::SendChatMessage(const string& message)
 {
+#ifdef BUILD_CLIENT
 	if (UChatWidget::s_main != nullptr)
 		UChatWidget::s_main->LogMessage(nullptr, message);
+#endif
 }
\ No newline at end of file
@@ -1,5 +1,5 @@
 #pragma once
-#include "Core\Core-Common.h"
+#include "Core/Core-Common.h"
 #include "BPlayerController.h"
 
 
@@ -8,7 +8,7 @@
 */
 class ABMatchController : public ALevelController
 {
-	CLASS_BODY()
+	CLASS_BODY(ALevelController)
 public:
 	enum MatchState : uint8
 	{
@@ -1,11 +1,15 @@
 #include "BPlayerController.h"
+#ifdef BUILD_CLIENT
 #include "ChatWidget.h"
+#endif
 #include "LobbyController.h"
 
 #include "APIController.h"
 
 
 CLASS_SOURCE(OBPlayerController)
+
+#ifdef BUILD_CLIENT
 const std::vector<Colour> OBPlayerController::s_supportedColours(
 {
 
@@ -34,6 +38,7 @@ const std::vector<Colour> OBPlayerController::s_supportedColours(
 	Colour(0,0,0) // Black for out of bounds indicies
 }
 );
+#endif
 
 std::queue<uint32> OBPlayerController::s_colourQueue({ 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15 });
 
@@ -52,8 +57,10 @@ void OBPlayerController::OnBegin()
 		AssignColour();
 
 
+#ifdef BUILD_CLIENT
 	if (UChatWidget::s_main != nullptr)
 		UChatWidget::s_main->LogMessage(nullptr, GetDisplayName() + " has connected.");
+#endif
 }
 
 void OBPlayerController::OnDestroy() 
@@ -69,8 +76,10 @@ void OBPlayerController::OnDestroy()
 	}
 
 
+#ifdef BUILD_CLIENT
 	if (UChatWidget::s_main != nullptr)
 		UChatWidget::s_main->LogMessage(nullptr, GetDisplayName() + " has disconnected.");
+#endif
 }
 
 bool OBPlayerController::RegisterRPCs(const char* func, RPCInfo& outInfo) const 
@@ -117,8 +126,10 @@ void OBPlayerController::SendMessage(const string& message)
 
 void OBPlayerController::BroadcastMessage(const string& message) 
 {
+#ifdef BUILD_CLIENT
 	if (UChatWidget::s_main != nullptr)
 		UChatWidget::s_main->LogMessage(this, message);
+#endif
 }
 
 void OBPlayerController::AssignColour()
@@ -1,5 +1,5 @@
 #pragma once
-#include "Core\Core-Common.h"
+#include "Core/Core-Common.h"
 #include "BCharacter.h"
 
 #include <queue>
@@ -12,7 +12,7 @@
 */
 class OBPlayerController : public OPlayerController
 {
-	CLASS_BODY()
+	CLASS_BODY(OPlayerController)
 	friend class ABMatchController;
 	friend class APINetLayer;
 	friend class OAPIController;
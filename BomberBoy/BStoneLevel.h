@@ -3,7 +3,7 @@
 
 class LBStoneLevel : public LBGameLevelBase
 {
-	CLASS_BODY()
+	CLASS_BODY(LBGameLevelBase)
 public:
 	/** Callback for when this arena should be setup */
 	virtual void BuildArena(ABLevelArena* arena);
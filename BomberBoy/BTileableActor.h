@@ -1,5 +1,5 @@
 #pragma once
-#include "Core\Core-Common.h"
+#include "Core/Core-Common.h"
 #include "BLevelArena.h"
 
 /**
@@ -7,7 +7,7 @@
 */
 class ABTileableActor : public AActor
 {
-	CLASS_BODY()
+	CLASS_BODY(AActor)
 public:
 	enum Direction : uint8
 	{
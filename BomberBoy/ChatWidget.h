@@ -1,5 +1,5 @@
 #pragma once
-#include "Core\Core-Common.h"
+#include "Core/Core-Common.h"
 #include "BPlayerController.h"
 
 
@@ -8,7 +8,7 @@
 
 class UChatWidget : public UInputField
 {
-	CLASS_BODY()
+	CLASS_BODY(UInputField)
 public:
 	static UChatWidget* s_main;
 
@@ -1,4 +1,5 @@
 #include "ConnectMenu.h"
+#include <stdexcept>
 
 
 void ConnectMenu::Build(AHUD* hud, const sf::Font* font, const ULabel::ScalingMode& scalingMode, const vec2 anchor)
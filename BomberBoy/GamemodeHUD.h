@@ -1,10 +1,10 @@
 #pragma once
-#include "Core\Core-Common.h"
+#include "Core/Core-Common.h"
 
 
 class AGamemodeHUD : public AHUD
 {
-	CLASS_BODY()
+	CLASS_BODY(AHUD)
 public:
 	virtual void OnBegin() override;
 };
@@ -1,4 +1,6 @@
 #include "HostMenu.h"
+#include <stdexcept>
+#include <algorithm>
 
 
 
@@ -0,0 +1,381 @@
+#include "LoadTest.h"
+#include "Core/NetRemoteSession.h"
+
+#include "BCharacter.h"
+#include "BBomb.h"
+#include "BPlayerController.h"
+#include "LobbyController.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+
+LoadTestBot::LoadTestBot(const uint32& id, const uint32& seed, LoadTestGameFactory createGame) :
+	m_id(id),
+	m_random(seed)
+{
+	std::vector<string> args;
+	m_engine = new Engine(args);
+	m_game = createGame();
+
+	// Tick once, so the default level is loaded before joining
+	m_engine->Hook(m_game);
+	m_engine->Tick(0.0f);
+
+	m_bombTimer = RandomRange(2.0f, 5.0f);
+}
+
+LoadTestBot::~LoadTestBot()
+{
+	// Same order as a normal launch (Game is closed before the engine it's hooked onto)
+	delete m_game;
+	delete m_engine;
+}
+
+bool LoadTestBot::Connect(const NetIdentity& server)
+{
+	return m_engine->GetNetController()->JoinSession(server);
+}
+
+void LoadTestBot::Tick(const float& deltaTime, const float& time, LoadTestStats& stats)
+{
+	// Inputs are applied before the tick, so they go out in this net update
+	RunScript(deltaTime, time, stats);
+	m_engine->Tick(deltaTime);
+	ObserveBombs(time, stats);
+}
+
+void LoadTestBot::RunScript(const float& deltaTime, const float& time, LoadTestStats& stats)
+{
+	if (!IsConnected())
+		return;
+
+	LLevel* level = m_game->GetCurrentLevel();
+	OBPlayerController* player = m_game->GetFirstObject<OBPlayerController>(true);
+	if (level == nullptr || player == nullptr)
+		return;
+
+
+	// Ready up and vote for a random map, once per lobby
+	if (m_readyLevel != level && dynamic_cast<ALobbyController*>(level->GetLevelController()) != nullptr)
+	{
+		player->SetReady(true);
+		player->SetMapVote(std::uniform_int_distribution<uint32>(0, (uint32)ALobbyController::s_supportedLevels.size() - 1)(m_random));
+		m_readyLevel = level;
+		return;
+	}
+
+
+	ABCharacter* character = player->GetCharacter();
+	if (character == nullptr || character->IsDead() || !character->IsActive())
+		return;
+
+	// Random walk, turning every so often or when blocked
+	m_directionTimer -= deltaTime;
+	if (!character->IsMoving())
+	{
+		if (m_directionTimer <= 0.0f || !character->AttemptMove(m_direction))
+		{
+			m_direction = (ABTileableActor::Direction)std::uniform_int_distribution<uint32>(0, 3)(m_random);
+			m_directionTimer = RandomRange(0.5f, 2.0f);
+		}
+	}
+
+	// Only one request is timed at once, so the bomb seen can be matched to it
+	m_bombTimer -= deltaTime;
+	if (m_bombTimer <= 0.0f && m_bombRequestTime < 0.0f)
+	{
+		character->RequestBomb();
+		m_bombRequestTime = time;
+		m_bombTimer = RandomRange(2.0f, 5.0f);
+		++stats.bombsRequested;
+	}
+}
+
+void LoadTestBot::ObserveBombs(const float& time, LoadTestStats& stats)
+{
+	LLevel* level = m_game->GetCurrentLevel();
+	if (level != m_observedLevel)
+	{
+		m_activeBombs.clear();
+		m_observedLevel = level;
+	}
+	if (level == nullptr)
+		return;
+
+
+	// A bomb of ours which wasn't active last tick has just been placed
+	bool placed = false;
+	std::vector<const ABBomb*> activeBombs;
+	for (ABBomb* bomb : level->GetActiveActors<ABBomb>())
+	{
+		if (!bomb->IsActive() || !bomb->IsNetOwner())
+			continue;
+
+		activeBombs.emplace_back(bomb);
+		if (std::find(m_activeBombs.begin(), m_activeBombs.end(), bomb) == m_activeBombs.end())
+			placed = true;
+	}
+	m_activeBombs.swap(activeBombs);
+
+
+	if (m_bombRequestTime < 0.0f)
+		return;
+
+	if (placed)
+	{
+		stats.latencies.emplace_back(time - m_bombRequestTime);
+		m_bombRequestTime = -1.0f;
+	}
+	else if (time - m_bombRequestTime >= LOAD_TEST_BOMB_TIMEOUT)
+	{
+		// Dropped, or refused by the host (e.g. Tile already has a bomb)
+		++stats.bombsUnanswered;
+		m_bombRequestTime = -1.0f;
+	}
+}
+
+bool LoadTestBot::IsConnected() const
+{
+	const NetRemoteSession* session = dynamic_cast<const NetRemoteSession*>(m_engine->GetNetController()->GetSession());
+	return session != nullptr && session->GetConnectionStatus() == LocalClientStatus::Connected;
+}
+
+bool LoadTestBot::IsPlaying() const
+{
+	if (!IsConnected())
+		return false;
+
+	OBPlayerController* player = m_game->GetFirstObject<OBPlayerController>(true);
+	ABCharacter* character = player == nullptr ? nullptr : player->GetCharacter();
+	return character != nullptr && character->IsActive() && !character->IsDead();
+}
+
+uint64 LoadTestBot::GetBytesSent() const
+{
+	const NetSession* session = m_engine->GetNetController()->GetSession();
+	return session == nullptr ? 0 : session->GetBytesSent();
+}
+
+uint64 LoadTestBot::GetBytesReceived() const
+{
+	const NetSession* session = m_engine->GetNetController()->GetSession();
+	return session == nullptr ? 0 : session->GetBytesReceived();
+}
+
+
+
+/**
+* Log the results for a period of the test
+* @param title			What period the results cover
+* @param stats			The results to log
+* @param bots			The bots to log the state of
+* @param duration		How long the period was (In seconds)
+* @param bytesSent		Bytes sent by all bots over the period
+* @param bytesReceived	Bytes received by all bots over the period
+* @param tickTimes		How long each harness tick took (In seconds)
+*/
+static void LogLoadTestReport(const char* title, LoadTestStats& stats, const std::vector<LoadTestBot*>& bots, const float& duration, const uint64& bytesSent, const uint64& bytesReceived, std::vector<float>& tickTimes)
+{
+	uint32 connected = 0;
+	uint32 playing = 0;
+	for (const LoadTestBot* bot : bots)
+	{
+		if (bot->IsConnected())
+			++connected;
+		if (bot->IsPlaying())
+			++playing;
+	}
+
+	LOG("Load test %s (%.1fs):", title, duration);
+	LOG("\t-Bots: %i/%i connected, %i playing", connected, (uint32)bots.size(), playing);
+	LOG("\t-Bandwidth: up %.1f KB/s, down %.1f KB/s (%.2f/%.2f KB/s per bot)",
+		(float)bytesSent / 1024.0f / duration,
+		(float)bytesReceived / 1024.0f / duration,
+		connected == 0 ? 0.0f : (float)bytesSent / 1024.0f / duration / (float)connected,
+		connected == 0 ? 0.0f : (float)bytesReceived / 1024.0f / duration / (float)connected
+	);
+
+	if (stats.latencies.size() != 0)
+	{
+		std::vector<float>& latencies = stats.latencies;
+		std::sort(latencies.begin(), latencies.end());
+
+		float total = 0.0f;
+		for (const float& latency : latencies)
+			total += latency;
+
+		LOG("\t-Bomb latency: avg %.1fms, p50 %.1fms, p95 %.1fms, max %.1fms",
+			1000.0f * total / (float)latencies.size(),
+			1000.0f * latencies[latencies.size() / 2],
+			1000.0f * latencies[(latencies.size() * 95) / 100],
+			1000.0f * latencies.back()
+		);
+	}
+	LOG("\t-Bombs: %i requested, %i seen, %i unanswered", stats.bombsRequested, (uint32)stats.latencies.size(), stats.bombsUnanswered);
+
+	if (tickTimes.size() != 0)
+	{
+		float total = 0.0f;
+		float max = 0.0f;
+		for (const float& tickTime : tickTimes)
+		{
+			total += tickTime;
+			max = std::max(max, tickTime);
+		}
+		LOG("\t-Harness tick: avg %.2fms, max %.2fms", 1000.0f * total / (float)tickTimes.size(), 1000.0f * max);
+	}
+}
+
+/**
+* Parse ip[:port] into an identity
+* @param address		The string to parse
+* @returns The identity (Using the default port, if none given or it is invalid)
+*/
+static NetIdentity ParseIdentity(const string& address)
+{
+	const size_t split = address.find(':');
+	if (split == string::npos)
+		return NetIdentity(sf::IpAddress(address), 20010);
+
+	int32 port = 0;
+	try { port = std::stoi(address.substr(split + 1)); }
+	catch (std::invalid_argument e) {}
+	catch (std::out_of_range e) {}
+
+	if (port <= 0 || port > 0xFFFF)
+	{
+		LOG_ERROR("Invalid port in -connect '%s' (Using %i)", address.c_str(), 20010);
+		port = 20010;
+	}
+	return NetIdentity(sf::IpAddress(address.substr(0, split)), (uint16)port);
+}
+
+
+int RunLoadTest(const std::vector<string>& args, LoadTestGameFactory createGame)
+{
+	uint32 botCount = LOAD_TEST_DEFAULT_BOTS;
+	float duration = LOAD_TEST_DEFAULT_DURATION;
+	uint32 seed = 0;
+	NetIdentity server(sf::IpAddress::getLocalAddress(), 20010);
+
+	for (uint32 i = 0; i + 1 < args.size(); ++i)
+	{
+		const string& arg = args[i];
+
+		// Malformed values are reported and left at their defaults
+		try
+		{
+			if (arg == "-bots")
+				botCount = (uint32)std::stoi(args[++i]);
+			else if (arg == "-duration")
+				duration = std::stof(args[++i]);
+			else if (arg == "-seed")
+				seed = (uint32)std::stoul(args[++i]);
+			else if (arg == "-connect")
+				server = ParseIdentity(args[++i]);
+		}
+		catch (std::invalid_argument e) { LOG_ERROR("Ignoring %s '%s' (Not a number)", arg.c_str(), args[i].c_str()); }
+		catch (std::out_of_range e) { LOG_ERROR("Ignoring %s '%s' (Out of range)", arg.c_str(), args[i].c_str()); }
+	}
+
+	if (botCount == 0 || botCount > LOAD_TEST_MAX_BOTS)
+	{
+		LOG_ERROR("Load test supports 1-%i bots (Given %i)", LOAD_TEST_MAX_BOTS, botCount);
+		return 1;
+	}
+
+
+	std::vector<LoadTestBot*> bots;
+	bots.reserve(botCount);
+	for (uint32 i = 0; i < botCount; ++i)
+		bots.emplace_back(new LoadTestBot(i, seed + i, createGame));
+
+	LOG("Load test started (%i bots against %s:%i for %.0fs)", botCount, server.ip.toString().c_str(), server.port, duration);
+
+
+	LoadTestStats intervalStats;
+	LoadTestStats totalStats;
+	std::vector<float> intervalTickTimes;
+	std::vector<float> totalTickTimes;
+
+	uint64 lastBytesSent = 0;
+	uint64 lastBytesReceived = 0;
+	uint64 totalBytesSent = 0;
+	uint64 totalBytesReceived = 0;
+
+	float time = 0.0f;
+	float reportTimer = 0.0f;
+
+	// Fold the current interval into the totals
+	auto closeInterval = [&](const bool& log)
+	{
+		// Session counters restart if a bot reconnects, so only count growth
+		uint64 bytesSent = 0;
+		uint64 bytesReceived = 0;
+		for (const LoadTestBot* bot : bots)
+		{
+			bytesSent += bot->GetBytesSent();
+			bytesReceived += bot->GetBytesReceived();
+		}
+		const uint64 sentDelta = bytesSent >= lastBytesSent ? bytesSent - lastBytesSent : 0;
+		const uint64 receivedDelta = bytesReceived >= lastBytesReceived ? bytesReceived - lastBytesReceived : 0;
+		lastBytesSent = bytesSent;
+		lastBytesReceived = bytesReceived;
+		totalBytesSent += sentDelta;
+		totalBytesReceived += receivedDelta;
+
+		totalStats.latencies.insert(totalStats.latencies.end(), intervalStats.latencies.begin(), intervalStats.latencies.end());
+		totalStats.bombsRequested += intervalStats.bombsRequested;
+		totalStats.bombsUnanswered += intervalStats.bombsUnanswered;
+		totalTickTimes.insert(totalTickTimes.end(), intervalTickTimes.begin(), intervalTickTimes.end());
+
+		if (log)
+			LogLoadTestReport("report", intervalStats, bots, reportTimer, sentDelta, receivedDelta, intervalTickTimes);
+		intervalStats.Clear();
+		intervalTickTimes.clear();
+	};
+
+	const float tickLength = 1.0f / 50.0f;
+	uint32 connectIndex = 0;
+	sf::Clock clock;
+
+	while (time < duration)
+	{
+		const float deltaTime = (float)(clock.restart().asMicroseconds()) / 1000000.0f;
+		time += deltaTime;
+		reportTimer += deltaTime;
+
+		// Bring bots in one per tick, rather than all handshaking at once
+		if (connectIndex < bots.size())
+		{
+			LoadTestBot* bot = bots[connectIndex++];
+			if (!bot->Connect(server))
+				LOG_WARNING("Bot %i failed to connect", bot->GetID());
+		}
+
+		for (LoadTestBot* bot : bots)
+			bot->Tick(deltaTime, time, intervalStats);
+
+		const float tickTime = (float)(clock.getElapsedTime().asMicroseconds()) / 1000000.0f;
+		intervalTickTimes.emplace_back(tickTime);
+
+		if (reportTimer >= LOAD_TEST_REPORT_INTERVAL)
+		{
+			closeInterval(true);
+			reportTimer = 0.0f;
+		}
+
+		// Sleep off the rest of the tick
+		if (tickTime < tickLength)
+			sf::sleep(sf::microseconds((sf::Int64)((tickLength - tickTime) * 1000000.0f)));
+	}
+
+
+	closeInterval(false);
+	LogLoadTestReport("summary", totalStats, bots, time, totalBytesSent, totalBytesReceived, totalTickTimes);
+
+	for (LoadTestBot* bot : bots)
+		delete bot;
+	return 0;
+}
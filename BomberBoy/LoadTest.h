@@ -0,0 +1,156 @@
+#pragma once
+#include "Core/Core-Common.h"
+#include "BTileableActor.h"
+
+#include <random>
+
+
+class ABBomb;
+
+
+/**
+* How many bots are run, if not set by -bots
+*/
+#ifndef LOAD_TEST_DEFAULT_BOTS
+#define LOAD_TEST_DEFAULT_BOTS 8
+#endif
+
+/**
+* Most bots which can be run by a single harness
+*/
+#ifndef LOAD_TEST_MAX_BOTS
+#define LOAD_TEST_MAX_BOTS 64
+#endif
+
+/**
+* How long the test runs for, if not set by -duration (In seconds)
+*/
+#ifndef LOAD_TEST_DEFAULT_DURATION
+#define LOAD_TEST_DEFAULT_DURATION 60.0f
+#endif
+
+/**
+* How often results are logged whilst running (In seconds)
+*/
+#ifndef LOAD_TEST_REPORT_INTERVAL
+#define LOAD_TEST_REPORT_INTERVAL 5.0f
+#endif
+
+/**
+* How long to wait to see a requested bomb appear, before counting it as unanswered (In seconds)
+*/
+#ifndef LOAD_TEST_BOMB_TIMEOUT
+#define LOAD_TEST_BOMB_TIMEOUT 2.0f
+#endif
+
+
+/**
+* Callback to build a fully registered game, so each bot runs the same game as a normal launch
+*/
+typedef Game*(*LoadTestGameFactory)();
+
+
+/**
+* Results gathered by bots, since the last report
+*/
+struct LoadTestStats
+{
+	/// Time between requesting a bomb and seeing it placed (In seconds)
+	std::vector<float> latencies;
+	uint32 bombsRequested = 0;
+	uint32 bombsUnanswered = 0;
+
+	inline void Clear() { latencies.clear(); bombsRequested = 0; bombsUnanswered = 0; }
+};
+
+
+/**
+* A headless client which joins a server and plays through scripted inputs
+*/
+class LoadTestBot
+{
+private:
+	Engine* m_engine;
+	Game* m_game;
+	const uint32 m_id;
+	std::mt19937 m_random;
+
+	/// The level which has been readied up in (So it's only sent once per lobby)
+	const LLevel* m_readyLevel = nullptr;
+
+	ABTileableActor::Direction m_direction = ABTileableActor::Direction::Down;
+	float m_directionTimer = 0.0f;
+	float m_bombTimer = 0.0f;
+
+	/// When the outstanding bomb was requested (Or negative, if none outstanding)
+	float m_bombRequestTime = -1.0f;
+	/// The bombs which were active last tick
+	std::vector<const ABBomb*> m_activeBombs;
+	const LLevel* m_observedLevel = nullptr;
+
+public:
+	LoadTestBot(const uint32& id, const uint32& seed, LoadTestGameFactory createGame);
+	~LoadTestBot();
+
+	/**
+	* Start the handshake with the server
+	* @param server			The server to join
+	* @returns If the connection was started
+	*/
+	bool Connect(const NetIdentity& server);
+
+	/**
+	* Run the bot's script and tick its engine
+	* @param deltaTime		Time since last tick (In seconds)
+	* @param time			Time since the test started (In seconds)
+	* @param stats			Where to record any results
+	*/
+	void Tick(const float& deltaTime, const float& time, LoadTestStats& stats);
+
+private:
+	/**
+	* Apply inputs for this tick, as a player would
+	*/
+	void RunScript(const float& deltaTime, const float& time, LoadTestStats& stats);
+
+	/**
+	* Look for any newly placed bombs, to resolve an outstanding request
+	*/
+	void ObserveBombs(const float& time, LoadTestStats& stats);
+
+	/**
+	* @returns Random time between these bounds (In seconds)
+	*/
+	inline float RandomRange(const float& min, const float& max) { return std::uniform_real_distribution<float>(min, max)(m_random); }
+
+
+	/**
+	* Getters & Setters
+	*/
+public:
+	inline const uint32& GetID() const { return m_id; }
+
+	/**
+	* @returns If the handshake has completed and the connection is still alive
+	*/
+	bool IsConnected() const;
+
+	/**
+	* @returns If this bot currently has a live character
+	*/
+	bool IsPlaying() const;
+
+	uint64 GetBytesSent() const;
+	uint64 GetBytesReceived() const;
+};
+
+
+/**
+* Run bots against a server, logging bandwidth and latency as they play
+* Usage: -bots <count> [-connect <ip>[:port]] [-duration <seconds>] [-seed <seed>]
+* -NOTE: The server should be a separate process (Launched with -loadstats to log its tick time)
+* @param args			The launch args
+* @param createGame		Callback to build the game for each bot
+* @returns Exit code for the process
+*/
+int RunLoadTest(const std::vector<string>& args, LoadTestGameFactory createGame);
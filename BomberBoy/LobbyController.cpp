@@ -1,8 +1,11 @@
 #include "LobbyController.h"
 
 #include "BStoneLevel.h"
+#include <algorithm>
 
+#ifdef BUILD_CLIENT
 #include "LobbyHUD.h"
+#endif
 
 
 CLASS_SOURCE(ALobbyController)
@@ -108,7 +111,7 @@ void ALobbyController::OnTick(const float& deltaTime)
 
 
 	// If half of players are ready, start final start count down
-	const uint32 requiredReadies = std::max(m_players.size() / 2, 2U);
+	const uint32 requiredReadies = std::max<uint32>(m_players.size() / 2, 2U);
 	uint32 readyCount = 0;
 	for (auto player : m_players)
 		if (player->IsReady())
@@ -169,10 +172,12 @@ void ALobbyController::OnPlayerConnect(OPlayerController* player, const bool& ne
 	m_players.emplace_back(bplayer);
 
 
+#ifdef BUILD_CLIENT
 	// Update lobby HUD
 	ALobbyHUD* hud = dynamic_cast<ALobbyHUD*>(GetLevel()->GetHUD());
 	if (hud != nullptr)
 		hud->OnPlayerConnect(bplayer);
+#endif
 }
 
 void ALobbyController::OnPlayerDisconnect(OPlayerController* player) 
@@ -186,10 +191,12 @@ void ALobbyController::OnPlayerDisconnect(OPlayerController* player)
 	m_players.erase(std::remove(m_players.begin(), m_players.end(), bplayer), m_players.end());
 	m_mapVotes.erase(bplayer->GetNetworkID());
 
+#ifdef BUILD_CLIENT
 	// Update lobby HUD
 	ALobbyHUD* hud = dynamic_cast<ALobbyHUD*>(GetLevel()->GetHUD());
 	if (hud != nullptr)
 		hud->OnPlayerDisconnect(bplayer);
+#endif
 }
 
 
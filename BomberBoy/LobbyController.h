@@ -1,5 +1,6 @@
 #pragma once
-#include "Core\Core-Common.h"
+#include "Core/Core-Common.h"
+#include <map>
 #include "BPlayerController.h"
 
 
@@ -42,7 +43,7 @@ inline bool Decode<PlayerVoteMap>(ByteBuffer& buffer, PlayerVoteMap& out, void*
 */
 class ALobbyController : public ALevelController
 {
-	CLASS_BODY()
+	CLASS_BODY(ALevelController)
 public:
 	static const std::vector<SubClassOf<LLevel>> s_supportedLevels;
 
@@ -36,7 +36,7 @@ void ALobbyHUD::OnBegin()
 
 		ULabel* icon = AddElement<ULabel>();
 		icon->SetScalingMode(defaultScaling);
-		icon->SetTexture(GetAssetController()->GetTexture("Resources\\Items\\Default_Bomb.png.1"));
+		icon->SetTexture(GetAssetController()->GetTextureRegion("Resources\\Items\\Default_Bomb.png.1"));
 		icon->SetDrawBackground(true);
 
 		icon->SetLocation(vec2(-40, 110));
@@ -136,15 +136,26 @@ void PlayerCard::Build(AHUD* hud, const sf::Font* font, const ULabel::ScalingMod
 	m_icon->SetScalingMode(scalingMode);
 	m_icon->SetDrawBackground(true);
 	m_icon->SetColour(Colour(255, 255, 255, 255));
-	m_animation = hud->GetAssetController()->GetAnimation("Resources\\Character\\Down.anim");
-	if (m_animation != nullptr)
-		m_icon->SetTexture(m_animation->GetFrame(0));
+	m_animation.sheet = hud->GetAssetController()->GetAnimation(ABCharacter::GetAnimationID(ABCharacter::Direction::Down));
+	m_icon->SetTexture(m_animation.GetFrame(0.0f));
 
 	m_icon->SetSize(vec2(32, 41) * 1.5f);
 	m_icon->SetOrigin(vec2(0, 0));
 	m_icon->SetAnchor(anchor);
 	m_icon->SetLocation(location + vec2(5, -8));
 
+	// Drawn over the icon in the player's colour
+	m_iconMask = AddElement<ULabel>(hud);
+	m_iconMask->SetScalingMode(scalingMode);
+	m_iconMask->SetDrawBackground(true);
+	m_iconMask->SetColour(Colour(255, 255, 255, 255));
+	m_iconMask->SetTexture(m_animation.GetMask(0.0f));
+
+	m_iconMask->SetSize(m_icon->GetSize());
+	m_iconMask->SetOrigin(m_icon->GetOrigin());
+	m_iconMask->SetAnchor(anchor);
+	m_iconMask->SetLocation(m_icon->GetLocation());
+
 
 	m_name = AddElement<ULabel>(hud);
 	m_name->SetScalingMode(scalingMode);
@@ -166,6 +177,7 @@ void PlayerCard::SetPlayer(OBPlayerController* player)
 	{
 		m_background->SetColour(Colour(50, 50, 50, 255));
 		m_icon->SetColour(Colour(0, 0, 0, 255));
+		m_iconMask->SetColour(Colour(0, 0, 0, 255));
 		m_name->SetText("");
 	}
 	else
@@ -176,6 +188,7 @@ void PlayerCard::SetPlayer(OBPlayerController* player)
 			m_background->SetColour(Colour(200, 200, 200, 255));
 
 		m_icon->SetColour(Colour(255, 255, 255, 255));
+		m_iconMask->SetColour(player->GetColour());
 		m_name->SetText(player->GetDisplayName());
 	}
 	m_player = player;
@@ -190,19 +203,27 @@ void PlayerCard::UpdateDisplay(AHUD* hud)
 	if (m_colourIndex != m_player->GetColourIndex())
 	{
 		m_colourIndex = m_player->GetColourIndex();
-		string code = m_player->GetColourCode();
-		m_animation = hud->GetAssetController()->GetAnimation("Resources\\Character\\Down.anim." + code);
+		m_iconMask->SetColour(m_player->GetColour());
 	}
 
-	if (m_player->IsReady())
-		m_icon->SetTexture(m_animation->GetCurrentFrame());
-	else
-		m_icon->SetTexture(m_animation->GetFrame(0));
+	if (m_animation.sheet == nullptr)
+		return;
+
+	// Only animate whilst ready
+	if (!m_player->IsReady())
+		m_animation.Stop();
+	else if (!m_animation.bIsPlaying)
+		m_animation.Play(hud->GetAssetController()->GetAnimationTime());
+
+	const float time = hud->GetAssetController()->GetAnimationTime();
+	m_icon->SetTexture(m_animation.GetFrame(time));
+	m_iconMask->SetTexture(m_animation.GetMask(time));
 }
 
 void PlayerCard::SetLockedStyle()
 {
 	m_background->SetColour(Colour(30, 30, 30, 255));
 	m_icon->SetActive(false);
+	m_iconMask->SetActive(false);
 	m_name->SetText("");
 }
\ No newline at end of file
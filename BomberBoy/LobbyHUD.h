@@ -1,5 +1,5 @@
 #pragma once
-#include "Core\Core-Common.h"
+#include "Core/Core-Common.h"
 #include "MenuContainer.h"
 #include "MapVoteMenu.h"
 
@@ -18,10 +18,11 @@ private:
 	OBPlayerController* m_player = nullptr;
 
 	uint32 m_colourIndex = 17;
-	const AnimationSheet* m_animation;
+	AnimationPlayback m_animation;
 
 	ULabel* m_background;
 	ULabel* m_icon;
+	ULabel* m_iconMask;
 	ULabel* m_name;
 
 public:
@@ -58,7 +59,7 @@ public:
 */
 class ALobbyHUD : public AHUD
 {
-	CLASS_BODY()
+	CLASS_BODY(AHUD)
 private:
 	OBPlayerController* m_localPlayer = nullptr;
 	MapVoteMenu m_mapVoteMenu;
@@ -1,7 +1,9 @@
 #include "LobbyLevel.h"
 
 #include "LobbyController.h"
+#ifdef BUILD_CLIENT
 #include "LobbyHUD.h"
+#endif
 
 CLASS_SOURCE(LLobbyLevel)
 
@@ -9,5 +11,7 @@ CLASS_SOURCE(LLobbyLevel)
 LLobbyLevel::LLobbyLevel()
 {
 	levelControllerClass = ALobbyController::StaticClass();
+#ifdef BUILD_CLIENT
 	hudClass = ALobbyHUD::StaticClass();
+#endif
 }
\ No newline at end of file
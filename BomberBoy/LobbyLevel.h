@@ -1,5 +1,5 @@
 #pragma once
-#include "Core\Core-Common.h"
+#include "Core/Core-Common.h"
 
 
 /**
@@ -7,7 +7,7 @@
 */
 class LLobbyLevel : public LLevel
 {
-	CLASS_BODY()
+	CLASS_BODY(LLevel)
 public:
 	LLobbyLevel();
 };
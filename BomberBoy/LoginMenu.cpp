@@ -1,5 +1,9 @@
 #include "LoginMenu.h"
+#ifdef _WIN32
 #include <Windows.h>
+#else
+#include <cstdlib>
+#endif
 
 
 void LoginMenu::Build(AHUD* hud, const sf::Font* font, const ULabel::ScalingMode& scalingMode, const vec2 anchor)
@@ -107,7 +111,11 @@ void LoginMenu::Build(AHUD* hud, const sf::Font* font, const ULabel::ScalingMode
 	registerButton->SetCallback([this]()
 	{
 		// Open register page
+#ifdef _WIN32
 		ShellExecute(nullptr, "open", (m_apiController->GetDomain() + "/register.html").c_str(), nullptr, nullptr, SW_SHOWNORMAL);
+#else
+		system(("xdg-open \"" + m_apiController->GetDomain() + "/register.html\"").c_str());
+#endif
 	});
 
 
@@ -10,9 +10,11 @@
 #include "BGameLevelBase.h"
 #include "BStoneLevel.h"
 
+#ifdef BUILD_CLIENT
 #include "MainMenuHUD.h"
 #include "LobbyHUD.h"
 #include "GamemodeHUD.h"
+#endif
 
 #include "BLevelController.h"
 #include "LobbyController.h"
@@ -21,60 +23,84 @@
 #include "BPlayerController.h"
 #include "BLevelArena.h"
 
-#include "Core\Camera.h"
+#include "Core/Camera.h"
+#include "LoadTest.h"
 
 
-static inline int entry(std::vector<string>& args)
+/**
+* Build the game with everything registered
+*/
+static Game* CreateGame()
 {
-	LOG("Discovered %i cmd arguments", args.size());
-	for (string& str : args)
-		LOG("\t'%s'", str.c_str())
-
-
-	// Setup engine
-	Engine engine(args);
+	Game* game = new Game("Bomber Boy", Version(0,1,0));
+
+	// Register misc.
+	game->RegisterClass(OAPIController::StaticClass());
+	game->RegisterClass(OBPlayerController::StaticClass());
+	game->RegisterClass(ABMatchController::StaticClass());
+	game->RegisterClass(ALobbyController::StaticClass());
+
+
+	// Add levels
+	game->RegisterClass(LMainMenuLevel::StaticClass());
+	game->RegisterClass(LLobbyLevel::StaticClass());
+	game->RegisterClass(LBGameLevelBase::StaticClass());
+	game->RegisterClass(LBStoneLevel::StaticClass());
+
+	game->defaultLevel = LMainMenuLevel::StaticClass();
+	game->defaultNetLevel = LLobbyLevel::StaticClass();
+	
+
+	// Register assets
+	ABCharacter::RegisterAssets(game);
+	ABLevelArena::RegisterAssets(game);
+#ifdef BUILD_CLIENT
+	game->GetAssetController()->RegisterFont("Resources\\UI\\coolvetica.ttf");
+#endif
+	
+
+	// Register actors
+	game->RegisterClass(ACamera::StaticClass());
+#ifdef BUILD_CLIENT
+	game->RegisterClass(AMainMenuHUD::StaticClass());
+	game->RegisterClass(ALobbyHUD::StaticClass());
+	game->RegisterClass(AGamemodeHUD::StaticClass());
+#endif
 
-	// Setup game
-	Game game("Bomber Boy", Version(0,1,0));
-	{
-		// Register misc.
-		game.RegisterClass(OAPIController::StaticClass());
-		game.RegisterClass(OBPlayerController::StaticClass());
-		game.RegisterClass(ABMatchController::StaticClass());
-		game.RegisterClass(ALobbyController::StaticClass());
 
+	game->playerControllerClass = OBPlayerController::StaticClass();
+	return game;
+}
 
-		// Add levels
-		game.RegisterClass(LMainMenuLevel::StaticClass());
-		game.RegisterClass(LLobbyLevel::StaticClass());
-		game.RegisterClass(LBGameLevelBase::StaticClass());
-		game.RegisterClass(LBStoneLevel::StaticClass());
+static inline int entry(std::vector<string>& args)
+{
+	LOG("Discovered %i cmd arguments", (uint32)args.size());
+	for (string& str : args)
+		LOG("\t'%s'", str.c_str());
 
-		game.defaultLevel = LMainMenuLevel::StaticClass();
-		game.defaultNetLevel = LLobbyLevel::StaticClass();
-		
 
-		// Register assets
-		ABCharacter::RegisterAssets(&game);
-		ABLevelArena::RegisterAssets(&game);
-		game.GetAssetController()->RegisterFont("Resources\\UI\\coolvetica.ttf");
-		
+	// Run headless bots against a server, instead of launching
+	for (const string& arg : args)
+		if (arg == "-bots")
+			return RunLoadTest(args, CreateGame);
 
-		// Register actors
-		game.RegisterClass(ACamera::StaticClass());
-		game.RegisterClass(AMainMenuHUD::StaticClass());
-		game.RegisterClass(ALobbyHUD::StaticClass());
-		game.RegisterClass(AGamemodeHUD::StaticClass());
 
+	// Setup engine
+	Engine engine(args);
 
-		game.playerControllerClass = OBPlayerController::StaticClass();
-	}
+	// Setup game
+	Game* game = CreateGame();
 
 #ifdef API_SUPPORTED
-	game.RegisterSingleton(OAPIController::StaticClass());
-	game.netLayerClass = APINetLayer::StaticClass();
+	// Replays mustn't report anything upstream
+	if (!engine.IsReplaying())
+	{
+		game->RegisterSingleton(OAPIController::StaticClass());
+		game->netLayerClass = APINetLayer::StaticClass();
+	}
 #endif
-	engine.Launch(&game);
+	engine.Launch(game);
+	delete game;
 	return 0;
 }
 
@@ -87,6 +113,7 @@ static inline int entry(std::vector<string>& args)
 */
 
 
+#ifdef _WIN32
 /**
 * Convert cmd arguments into more usable string array
 */
@@ -142,4 +169,21 @@ int CALLBACK WinMain(
 	return entry(args);
 }
 
+#endif
+#else
+
+/**
+* Convert cmd arguments into more usable string array
+*/
+std::vector<string> GetArgs(int argc, char** argv)
+{
+	return std::vector<string>(argv, argv + argc);
+}
+
+int main(int argc, char** argv)
+{
+	std::vector<string> args = GetArgs(argc, argv);
+	return entry(args);
+}
+
 #endif
\ No newline at end of file
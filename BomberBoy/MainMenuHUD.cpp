@@ -31,7 +31,7 @@ void AMainMenuHUD::OnBegin()
 
 		ULabel* icon = AddElement<ULabel>();
 		icon->SetScalingMode(defaultScaling);
-		icon->SetTexture(GetAssetController()->GetTexture("Resources\\Items\\Default_Bomb.png.0"));
+		icon->SetTexture(GetAssetController()->GetTextureRegion("Resources\\Items\\Default_Bomb.png.0"));
 		icon->SetDrawBackground(true);
 
 		icon->SetLocation(vec2(-156, 110));
@@ -1,5 +1,5 @@
 #pragma once
-#include "Core\Core-Common.h"
+#include "Core/Core-Common.h"
 
 #include "LoginMenu.h"
 #include "MenuContainer.h"
@@ -10,7 +10,7 @@
 
 class AMainMenuHUD : public AHUD
 {
-	CLASS_BODY()
+	CLASS_BODY(AHUD)
 private:
 	LoginMenu		m_loginMenu;
 	HostMenu		m_hostMenu;
@@ -1,7 +1,9 @@
 #include "MainMenuLevel.h"
 
-#include "Core\Camera.h"
+#include "Core/Camera.h"
+#ifdef BUILD_CLIENT
 #include "MainMenuHUD.h"
+#endif
 
 
 CLASS_SOURCE(LMainMenuLevel)
@@ -9,7 +11,9 @@ CLASS_SOURCE(LMainMenuLevel)
 
 LMainMenuLevel::LMainMenuLevel()
 {
+#ifdef BUILD_CLIENT
 	hudClass = AMainMenuHUD::StaticClass();
+#endif
 }
 
 void LMainMenuLevel::OnBuildLevel() 
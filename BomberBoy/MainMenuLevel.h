@@ -1,10 +1,10 @@
 #pragma once
-#include "Core\Core-Common.h"
+#include "Core/Core-Common.h"
 
 
 class LMainMenuLevel : public LLevel
 {
-	CLASS_BODY()
+	CLASS_BODY(LLevel)
 public:
 	LMainMenuLevel();
 
@@ -1,7 +1,7 @@
-#include "Includes\Core\Actor.h"
-#include "Includes\Core\Level.h"
-#include "Includes\Core\Game.h"
-#include "Includes\Core\Engine.h"
+#include "Includes/Core/Actor.h"
+#include "Includes/Core/Level.h"
+#include "Includes/Core/Game.h"
+#include "Includes/Core/Engine.h"
 
 
 CLASS_SOURCE(AActor, CORE_API)
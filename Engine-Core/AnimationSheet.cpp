@@ -1,15 +1,12 @@
-#include "Includes\Core\AnimationSheet.h"
+#include "Includes/Core/AnimationSheet.h"
 
 
 
-void AnimationSheet::UpdateAnimation(const float& deltaTime) 
+uint32 AnimationSheet::GetFrameIndex(const float& time) const
 {
-	m_timer += deltaTime;
+	if (m_timeline.size() <= 1 || time <= 0.0f)
+		return 0;
 
-	const float totalDuration = GetTotalDuration();
-	if (m_timer > totalDuration)
-		m_timer -= totalDuration;
-
-	const uint32 frame = (uint32)(m_timer/ m_frameDuration);
-	m_currentFrame = frame % m_timeline.size();
+	const uint32 frame = (uint32)(time / m_frameDuration);
+	return frame % m_timeline.size();
 }
\ No newline at end of file
@@ -1,17 +1,28 @@
-#include "Includes\Core\AssetController.h"
-#include "Includes\Core\Logger.h"
+#include "Includes/Core/AssetController.h"
+#include "Includes/Core/Logger.h"
+#include <algorithm>
 
 
+AssetController::AssetController()
+{
+	// Fill index 0, so invalid ids always resolve to empty assets
+	m_textureRegions.emplace_back();
+	m_animations.emplace_back(nullptr);
+	m_fonts.emplace_back(nullptr);
+}
+
 AssetController::~AssetController()
 {
-	for (auto& it : m_fonts)
-		delete it.second;
+	for (AnimationSheet* animation : m_animations)
+		delete animation;
 
-	for (auto& it : m_animations)
-		delete it.second;
+#ifdef BUILD_CLIENT
+	for (sf::Font* font : m_fonts)
+		delete font;
 
 	for (auto& it : m_textures)
 		delete it.second;
+#endif
 	LOG("Assets destroyed");
 }
 
@@ -23,35 +34,41 @@ inline static string GetKey(const string& path)
 	return key;
 }
 
-void AssetController::HandleUpdate(const float& deltaTime)
+template<typename IdType>
+inline static IdType FindID(const std::unordered_map<string, IdType>& lookup, const string& path)
 {
-	for (auto& it : m_animations)
-		it.second->UpdateAnimation(deltaTime);
+#ifdef BUILD_CLIENT
+	auto it = lookup.find(GetKey(path));
+	if (it != lookup.end())
+		return it->second;
+#endif
+	return IdType();
 }
 
-
-
-void AssetController::RegisterTexture(const string& path, sf::Texture* texture) 
-{
 #ifdef BUILD_CLIENT
+TextureID AssetController::RegisterTexture(const string& path, sf::Texture* texture) 
+{
 	const string key = GetKey(path);
 
-	if (m_textures.find(key) != m_textures.end())
+	if (m_textureIds.find(key) != m_textureIds.end())
 	{
 		LOG_WARNING("Multiple entries for texture '%s'", path.c_str());
 		delete texture;
+		return TextureID();
 	}
 	else
 	{
+		const TextureID id(m_textureRegions.size());
 		m_textures[key] = texture;
+		m_textureRegions.emplace_back(texture);
+		m_textureIds[key] = id;
 		//LOG("\t-Registered texture at '%s'", key.c_str());
+		return id;
 	}
-#else
-	delete texture;
-#endif
 }
+#endif
 
-void AssetController::RegisterTexture(const string& path, bool isSmoothed, bool isRepeated) 
+TextureID AssetController::RegisterTexture(const string& path, bool isSmoothed, bool isRepeated) 
 {
 #ifdef BUILD_CLIENT
 
@@ -59,12 +76,15 @@ void AssetController::RegisterTexture(const string& path, bool isSmoothed, bool
 	if (!texture->loadFromFile(path))
 	{
 		LOG_ERROR("Failed to load texture at '%s'", path.c_str());
-		return;
+		delete texture;
+		return TextureID();
 	}
 
 	texture->setSmooth(isSmoothed);
 	texture->setRepeated(isRepeated);
-	RegisterTexture(path, texture);
+	return RegisterTexture(path, texture);
+#else
+	return TextureID();
 #endif
 }
 
@@ -84,64 +104,114 @@ const sf::Texture* AssetController::GetTexture(const string& path) const
 }
 
 
+#ifdef BUILD_CLIENT
+TextureID AssetController::RegisterAtlasTexture(const string& path, const sf::Image& image)
+{
+	const string key = GetKey(path);
+
+	if (m_textureIds.find(key) != m_textureIds.end())
+	{
+		LOG_WARNING("Multiple entries for texture '%s'", path.c_str());
+		return TextureID();
+	}
+
+	TextureRegion region = m_atlas.Pack(image);
+
+	// Too large for the atlas, so fallback to a standalone texture
+	if (!region.IsValid())
+	{
+		LOG_WARNING("Texture '%s' (%ix%i) is too large for atlas, so will be stored separately", path.c_str(), image.getSize().x, image.getSize().y);
+		sf::Texture* texture = new sf::Texture;
+		texture->loadFromImage(image);
+		texture->setSmooth(false);
+		return RegisterTexture(path, texture);
+	}
+
+	const TextureID id(m_textureRegions.size());
+	m_textureRegions.emplace_back(region);
+	m_textureIds[key] = id;
+	return id;
+}
+#endif
+
+TextureID AssetController::RegisterAtlasTexture(const string& path)
+{
+#ifdef BUILD_CLIENT
+
+	sf::Image image;
+	if (!image.loadFromFile(path))
+	{
+		LOG_ERROR("Failed to load texture at '%s'", path.c_str());
+		return TextureID();
+	}
+
+	return RegisterAtlasTexture(path, image);
+#else
+	return TextureID();
+#endif
+}
+
+TextureID AssetController::GetTextureID(const string& path) const
+{
+	return FindID(m_textureIds, path);
+}
+
+
 
-void AssetController::RegisterAnimation(const string& path, AnimationSheet* animation) 
+AnimationID AssetController::RegisterAnimation(const string& path, AnimationSheet* animation) 
 {
 #ifdef BUILD_CLIENT
 	const string key = GetKey(path);
 
-	if (m_animations.find(key) != m_animations.end())
+	if (m_animationIds.find(key) != m_animationIds.end())
 	{
 		LOG_WARNING("Multiple entries for animation '%s'", path.c_str());
 		delete animation;
+		return AnimationID();
 	}
 	else
 	{
-		m_animations[key] = animation;
+		const AnimationID id(m_animations.size());
+		m_animations.emplace_back(animation);
+		m_animationIds[key] = id;
 		//LOG("\t-Registered animation at '%s'", key.c_str());
+		return id;
 	}
 #else
 	delete animation;
+	return AnimationID();
 #endif
 }
 
-const AnimationSheet* AssetController::GetAnimation(const string& path) const 
+AnimationID AssetController::GetAnimationID(const string& path) const 
 {
-#ifdef BUILD_CLIENT
-	const string key = GetKey(path);
-
-	auto it = m_animations.find(key);
-	if (it == m_animations.end())
-		return nullptr;
-	else
-		return it->second;
-#else
-	return nullptr;
-#endif
+	return FindID(m_animationIds, path);
 }
 
 
-void AssetController::RegisterFont(const string& path, sf::Font* font)
-{
 #ifdef BUILD_CLIENT
+FontID AssetController::RegisterFont(const string& path, sf::Font* font)
+{
 	const string key = GetKey(path);
 
-	if (m_fonts.find(key) != m_fonts.end())
+	if (m_fontIds.find(key) != m_fontIds.end())
 	{
 		LOG_WARNING("Multiple entries for font '%s'", path.c_str());
 		delete font;
+		return FontID();
 	}
 	else
 	{
-		m_fonts[key] = font;
+		const FontID id(m_fonts.size());
+		m_fonts.emplace_back(font);
+		m_fontIds[key] = id;
 		//LOG("\t-Registered font at '%s'", key.c_str());
+		return id;
 	}
-#else
-	delete font;
-#endif
 }
+#endif
 
-void AssetController::RegisterFont(const string& path)
+FontID AssetController::RegisterFont(const string& path)
 {
 #ifdef BUILD_CLIENT
 
@@ -149,24 +219,17 @@ void AssetController::RegisterFont(const string& path)
 	if (!font->loadFromFile(path))
 	{
 		LOG_ERROR("Failed to load font at '%s'", path.c_str());
-		return;
+		delete font;
+		return FontID();
 	}
 
-	RegisterFont(path, font);
+	return RegisterFont(path, font);
+#else
+	return FontID();
 #endif
 }
 
-const sf::Font* AssetController::GetFont(const string& path) const
+FontID AssetController::GetFontID(const string& path) const
 {
-#ifdef BUILD_CLIENT
-	const string key = GetKey(path);
-
-	auto it = m_fonts.find(key);
-	if (it == m_fonts.end())
-		return nullptr;
-	else
-		return it->second;
-#else
-	return nullptr;
-#endif
+	return FindID(m_fontIds, path);
 }
\ No newline at end of file
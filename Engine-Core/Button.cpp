@@ -1,4 +1,4 @@
-#include "Includes\Core\Button.h"
+#include "Includes/Core/Button.h"
 
 
 CLASS_SOURCE(UButton, CORE_API)
@@ -1,5 +1,7 @@
-#include "Includes\Core\ByteBuffer.h"
+#include "Includes/Core/ByteBuffer.h"
 #include <memory>
+#include <cstring>
+#include <algorithm>
 
 
 void ByteBuffer::Push(const uint8* b, uint32 count)
@@ -1,4 +1,4 @@
-#include "Includes\Core\Camera.h"
+#include "Includes/Core/Camera.h"
 CLASS_SOURCE(ACamera, CORE_API)
 
 
@@ -7,9 +7,8 @@ ACamera::ACamera()
 }
 
 #ifdef BUILD_CLIENT
-void ACamera::OnDraw(sf::RenderWindow* window, const float& deltaTime)
+void ACamera::OnRender(RenderSnapshot& snapshot)
 {
-	sf::View view = sf::View(GetLocation(), vec2(window->getSize().x, window->getSize().y));
-	window->setView(view);
+	snapshot.SetView(GetLocation());
 }
 #endif
\ No newline at end of file
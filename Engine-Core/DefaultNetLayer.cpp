@@ -1,7 +1,7 @@
-#include "Includes\Core\DefaultNetLayer.h"
-#include "Includes\Core\Encoding.h"
-#include "Includes\Core\PlayerController.h"
-#include "Includes\Core\Game.h"
+#include "Includes/Core/DefaultNetLayer.h"
+#include "Includes/Core/Encoding.h"
+#include "Includes/Core/PlayerController.h"
+#include "Includes/Core/Game.h"
 
 
 CLASS_SOURCE(DefaultNetLayer, CORE_API)
@@ -1,14 +1,47 @@
-#include "Includes\Core\Engine.h"
-#include "Includes\Core\Game.h"
+#include "Includes/Core/Engine.h"
+#include "Includes/Core/Game.h"
+#include "Includes/Core/NetHostSession.h"
+#include "Includes/Core/NetReplaySession.h"
+
+#include <stdexcept>
 
 
 
 Engine::Engine(std::vector<string>& args) :
 	m_version(0,1,2)
 {
+	Logger::Start();
 	LOG("Engine Initializing");
 	LOG("\t-Engine Version (%i.%i.%i)", m_version.major, m_version.minor, m_version.patch);
 
+	for (uint32 i = 0; i < args.size(); ++i)
+	{
+		const string& arg = args[i];
+
+		if (arg == "-nettrace")
+			NetTrace::Enable();
+		else if (arg == "-netprofile")
+			NetProfiler::Enable();
+		else if (arg == "-loadstats")
+			bLogLoadStats = true;
+		else if (arg == "-maxplayers" && i + 1 < args.size())
+		{
+			int32 count = 0;
+			try { count = std::stoi(args[++i]); }
+			catch (std::invalid_argument e) {}
+			catch (std::out_of_range e) {}
+
+			if (count <= 0 || count > 0xFFFF)
+				LOG_ERROR("Ignoring -maxplayers '%s' (Expected 1-%i)", args[i].c_str(), 0xFFFF);
+			else
+				m_maxPlayerCount = (uint16)count;
+		}
+		else if (arg == "-record" && i + 1 < args.size())
+			m_recordPath = args[++i];
+		else if (arg == "-replay" && i + 1 < args.size())
+			m_replayPath = args[++i];
+	}
+
 #ifdef BUILD_CLIENT
 	m_inputController = new InputController;
 #else
@@ -26,7 +59,11 @@ Engine::~Engine()
 	if (m_inputController != nullptr)
 		delete m_inputController;
 
+	if (NetTrace::IsEnabled())
+		NetTrace::DumpChromeJson(NET_TRACE_PATH);
+
 	LOG("Engine destroyed");
+	Logger::Shutdown();
 }
 
 void Engine::Launch(Game* game)
@@ -35,20 +72,53 @@ void Engine::Launch(Game* game)
 	LOG("\t-Game Version (%i.%i.%i)", game->GetVersionNo().major, game->GetVersionNo().minor, game->GetVersionNo().patch);
 	m_game = game;
 
+
+	// Re-simulate a recorded match, instead of launching normally
+	if (IsReplaying())
+	{
+		if (!m_netController->ReplaySession(m_replayPath))
+			LOG_ERROR("Aborting replay (Failed to open '%s')", m_replayPath.c_str());
+		else
+		{
+			m_game->OnGameHooked(this);
+			ReplayLoop();
+		}
+
+		m_game = nullptr;
+		return;
+	}
+
 	
 #ifdef BUILD_CLIENT
 	// Launch display loop for handling visuals
 	sf::Thread m_displayThread(&Engine::DisplayLoop, this);
 	m_displayThread.launch();
 
+	if (!m_recordPath.empty())
+		LOG_WARNING("Ignoring -record, as only dedicated servers can record (The host's own input isn't captured)");
+
 #else
 	// Automatically open session on server
-	if (!m_netController->HostSession(m_netController->GetLocalIdentity()))
+	const uint16 maxPlayerCount = m_maxPlayerCount;
+	if (!m_netController->HostSession(m_netController->GetLocalIdentity(), 
+		[maxPlayerCount](NetLayer* layer)
+		{
+			if (maxPlayerCount != 0)
+				layer->GetSession()->SetMaxPlayerCount(maxPlayerCount);
+		}
+	))
 	{
 		LOG_ERROR("Aborting launch (Failed to launch session)");
 		return;
 	}
 
+	// Record before the game is hooked, so the replay starts from a fresh game
+	if (!m_recordPath.empty())
+	{
+		NetHostSession* session = static_cast<NetHostSession*>(m_netController->GetSession());
+		session->StartRecording(m_recordPath, m_version);
+	}
+
 #endif
 
 	// Launch into main loop
@@ -64,6 +134,19 @@ void Engine::Launch(Game* game)
 	m_game = nullptr;
 	LOG("Main engine loop closed");
 }
+
+void Engine::Hook(Game* game)
+{
+	LOG("Hooking game '%s' onto engine", game->GetName().c_str());
+	m_game = game;
+	m_game->OnGameHooked(this);
+}
+
+void Engine::Tick(const float& deltaTime)
+{
+	m_game->MainUpdate(deltaTime);
+	m_netController->HandleUpdate(deltaTime);
+}
 	
 
 void Engine::MainLoop()
@@ -78,8 +161,20 @@ void Engine::MainLoop()
 	{
 		// Tick logic 
 		const float deltaTime = (float)(clock.restart().asMicroseconds()) / 1000000.0f;
-		m_game->MainUpdate(deltaTime);
-		m_netController->HandleUpdate(deltaTime);
+		{
+#ifdef BUILD_CLIENT
+			sf::Lock lock(m_logicMutex);
+#endif
+			Tick(deltaTime);
+
+#ifdef BUILD_CLIENT
+			// Hand over what should be drawn this tick
+			m_game->CaptureRenderSnapshot();
+#endif
+		}
+
+		if (bLogLoadStats)
+			UpdateLoadStats((float)(clock.getElapsedTime().asMicroseconds()) / 1000000.0f, deltaTime);
 
 		// Sleep a little
 		// TODO - More elegant checks to compensate for large loops
@@ -92,6 +187,91 @@ void Engine::MainLoop()
 	LOG("Main game loop closed");
 }
 
+void Engine::ReplayLoop()
+{
+	LOG("Replay loop started");
+	NetReplaySession* session = static_cast<NetReplaySession*>(m_netController->GetSession());
+
+	sf::Clock clock;
+	sf::Clock tickClock;
+	float deltaTime;
+	float playTime = 0.0f;
+	float maxTickTime = 0.0f;
+
+
+	// No sleeping, so the replay runs as fast as the ticks allow
+	while (session->NextTick(deltaTime))
+	{
+		tickClock.restart();
+		Tick(deltaTime);
+		const float tickTime = (float)(tickClock.getElapsedTime().asMicroseconds()) / 1000000.0f;
+
+		if (tickTime > maxTickTime)
+			maxTickTime = tickTime;
+		playTime += deltaTime;
+
+		if (bLogLoadStats)
+			UpdateLoadStats(tickTime, deltaTime);
+	}
+
+
+	const float runTime = (float)(clock.getElapsedTime().asMicroseconds()) / 1000000.0f;
+	const uint32 tickCount = session->GetTickCount();
+
+	LOG("Replay finished: %i ticks (%.1fs of play) in %.2fs (%.1fx), tick avg %.3fms max %.3fms",
+		tickCount,
+		playTime,
+		runTime,
+		runTime == 0.0f ? 0.0f : playTime / runTime,
+		tickCount == 0 ? 0.0f : 1000.0f * runTime / (float)tickCount,
+		1000.0f * maxTickTime
+	);
+
+	if (session->IsInStep())
+		LOG("Replay stayed in step (%i checksums matched)", session->GetChecksumsMatched());
+	else
+		LOG_WARNING("Replay went out of step on tick %i (%i checksums matched, %i failed)", session->GetDesyncTick(), session->GetChecksumsMatched(), session->GetChecksumsFailed());
+}
+
+void Engine::UpdateLoadStats(const float& tickTime, const float& deltaTime)
+{
+	++m_loadStatsTicks;
+	m_loadStatsTotalTime += tickTime;
+	if (tickTime > m_loadStatsMaxTime)
+		m_loadStatsMaxTime = tickTime;
+
+	m_loadStatsTimer += deltaTime;
+	if (m_loadStatsTimer < ENGINE_LOAD_STATS_INTERVAL)
+		return;
+
+
+	NetSession* session = m_netController->GetSession();
+	const uint64 bytesSent = session == nullptr ? 0 : session->GetBytesSent();
+	const uint64 bytesReceived = session == nullptr ? 0 : session->GetBytesReceived();
+
+	// Counters restart with each session
+	const uint64 sentDelta = bytesSent >= m_loadStatsBytesSent ? bytesSent - m_loadStatsBytesSent : bytesSent;
+	const uint64 receivedDelta = bytesReceived >= m_loadStatsBytesReceived ? bytesReceived - m_loadStatsBytesReceived : bytesReceived;
+
+	const NetHostSession* hostSession = dynamic_cast<const NetHostSession*>(session);
+
+	LOG("Load: %i players, tick avg %.2fms max %.2fms over %i ticks, sent %.1f KB/s received %.1f KB/s",
+		hostSession == nullptr ? 0 : hostSession->GetPlayerCount(),
+		1000.0f * m_loadStatsTotalTime / (float)m_loadStatsTicks,
+		1000.0f * m_loadStatsMaxTime,
+		m_loadStatsTicks,
+		(float)sentDelta / 1024.0f / m_loadStatsTimer,
+		(float)receivedDelta / 1024.0f / m_loadStatsTimer
+	);
+
+	m_loadStatsTimer = 0.0f;
+	m_loadStatsTicks = 0;
+	m_loadStatsTotalTime = 0.0f;
+	m_loadStatsMaxTime = 0.0f;
+	m_loadStatsBytesSent = bytesSent;
+	m_loadStatsBytesReceived = bytesReceived;
+}
+
 
 #ifdef BUILD_CLIENT
 void Engine::DisplayLoop()
@@ -124,7 +304,11 @@ void Engine::DisplayLoop()
 		sf::Event event;
 		while (m_renderWindow->pollEvent(event))
 			HandleDisplayEvent(event);
-		m_inputController->PostPoll(m_game);
+		{
+			// Input is applied directly onto actors, so wait for logic
+			sf::Lock lock(m_logicMutex);
+			m_inputController->PostPoll(m_game);
+		}
 
 
 		// Clear window
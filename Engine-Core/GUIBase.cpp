@@ -1,5 +1,5 @@
-#include "Includes\Core\GUIBase.h"
-#include "Includes\Core\HUD.h"
+#include "Includes/Core/GUIBase.h"
+#include "Includes/Core/HUD.h"
 
 
 CLASS_SOURCE(UGUIBase, CORE_API)
@@ -18,6 +18,16 @@ void UGUIBase::OnLoaded(AHUD* hud)
 	OnBegin();
 }
 
+void UGUIBase::SetDrawingLayer(const uint8& layer)
+{
+	if (m_drawingLayer == layer)
+		return;
+
+	m_drawingLayer = layer;
+	if (m_parent != nullptr)
+		m_parent->OnElementLayerChanged(this);
+}
+
 void UGUIBase::Draw(sf::RenderWindow* window, const float& deltaTime) 
 {
 	vec2 drawSize = GetDrawSize(window);
@@ -54,6 +64,8 @@ void UGUIBase::DrawDefaultRect(sf::RenderWindow* window)
 	rect.setSize(m_size);
 	rect.setFillColor(m_colour);
 	rect.setTexture(m_texture);
+	if (m_texture != nullptr)
+		rect.setTextureRect(m_textureRect);
 	window->draw(rect);
 }
 
@@ -1,10 +1,10 @@
-#include "Includes\Core\Game.h"
-#include "Includes\Core\Engine.h"
+#include "Includes/Core/Game.h"
+#include "Includes/Core/Engine.h"
 
-#include "Includes\Core\PlayerController.h"
-#include "Includes\Core\LevelController.h"
+#include "Includes/Core/PlayerController.h"
+#include "Includes/Core/LevelController.h"
 
-#include "Includes\Core\DefaultNetLayer.h"
+#include "Includes/Core/DefaultNetLayer.h"
 
 
 Game::Game(string name, Version version) :
@@ -24,15 +24,25 @@ Game::~Game()
 	{
 		LOG("Closing level '%s'", m_currentLevel->GetClass()->GetName().c_str());
 		m_currentLevel->Destroy();
-		delete m_currentLevel;
+		m_closingLevels.emplace_back(m_currentLevel);
 		m_currentLevel = nullptr;
 	}
 
+	// Finish closing any levels
+	for (LLevel* level : m_closingLevels)
+	{
+		level->HandleDestroy(0xFFFFFFFF);
+		delete level;
+	}
+	m_closingLevels.clear();
+
+	delete m_desiredLevel;
+
 	// Perform object cleanup
 	for (OObject* object : m_activeObjects)
 	{
 		object->OnDestroy();
-		delete object;
+		MClass::DeletePooled(object);
 	}
 
 	LOG("Closed game '%s'", m_name.c_str());
@@ -41,8 +51,16 @@ Game::~Game()
 
 void Game::MainUpdate(const float& deltaTime)
 {
-	// Update assets
-	m_assetController.HandleUpdate(deltaTime);
+	// Delete actors from closed levels, a few at a time
+	if (m_closingLevels.size() != 0)
+	{
+		LLevel* level = m_closingLevels.front();
+		if (level->HandleDestroy(LEVEL_TEARDOWN_BUDGET))
+		{
+			delete level;
+			m_closingLevels.erase(m_closingLevels.begin());
+		}
+	}
 
 
 	// Perform level switch
@@ -54,30 +72,52 @@ void Game::MainUpdate(const float& deltaTime)
 		m_currentLevel->MainUpdate(deltaTime);
 
 
-	// Perform cleanup
+	// Perform cleanup (Compacted in a single pass, so mass destruction stays linear and order is kept)
+	// Objects to delete are swapped to the end, so they can be removed from the index before being deleted
+	uint32 keptCount = 0;
 	for (uint32 i = 0; i < m_activeObjects.size(); ++i)
 	{
 		OObject* object = m_activeObjects[i];
 		if (!object->IsDestroyed())
-			continue;
+			std::swap(m_activeObjects[keptCount++], m_activeObjects[i]);
+		else
+			m_objectIndex.MarkDirty(object->GetClass());
+	}
+	m_objectIndex.RemoveDestroyed();
 
-		// Remove object
-		m_activeObjects.erase(m_activeObjects.begin() + i);
-		--i;
+	for (uint32 i = keptCount; i < m_activeObjects.size(); ++i)
+	{
+		OObject* object = m_activeObjects[i];
 
 		// Remove networking reference
 		if (object->GetNetworkID() != 0)
-			m_netObjectLookup.erase(object->GetNetworkID());
+			m_netObjectLookup.Remove(object->GetNetworkID(), object);
 
-		delete object;
+		MClass::DeletePooled(object);
 	}
+	m_activeObjects.resize(keptCount);
 }
 
 #ifdef BUILD_CLIENT
+void Game::CaptureRenderSnapshot()
+{
+	RenderSnapshot& snapshot = m_renderSnapshots.BeginWrite();
+	if (m_currentLevel != nullptr)
+		m_currentLevel->Render(snapshot);
+	m_renderSnapshots.Publish();
+}
+
 void Game::DisplayUpdate(const float& deltaTime)
 {
+	sf::RenderWindow* window = m_engine->GetDisplayWindow();
+
+	// Draw the world from the latest snapshot (Never touches live actors, so can overlap logic)
+	m_renderSnapshots.AcquireLatest().Draw(window, m_spriteBatch);
+
+	// HUD works on live objects, so has to wait for logic to finish
+	sf::Lock lock(m_engine->GetLogicMutex());
 	if (m_currentLevel != nullptr)
-		m_currentLevel->DisplayUpdate(m_engine->GetDisplayWindow(), deltaTime);
+		m_currentLevel->DisplayUpdate(window, deltaTime);
 }
 #endif
 
@@ -85,6 +125,9 @@ void Game::OnGameHooked(Engine* engine)
 {
 	m_engine = engine;
 
+	// All game classes should be registered by now, so number them for fast type checks
+	MClass::BuildHierarchy();
+
 	// Spawn singletons
 	while (m_singletonObjects.size() != 0)
 	{
@@ -190,8 +233,10 @@ void Game::PerformLevelSwitch()
 		LOG("Closing level '%s'", m_currentLevel->GetClass()->GetName().c_str());
 		LLevel* old = m_currentLevel;
 		m_currentLevel = nullptr;
+
+		// Actors are deleted over the next few ticks, to avoid stalling on large levels
 		old->Destroy();
-		delete old;
+		m_closingLevels.emplace_back(old);
 	}
 
 
@@ -200,8 +245,7 @@ void Game::PerformLevelSwitch()
 	NetSession* session = GetSession();
 	if (session == nullptr)
 	{
-		auto playerList = GetActiveObjects<OPlayerController>();
-		if (playerList.size() == 0)
+		if (GetActiveObjects<OPlayerController>().IsEmpty())
 			SpawnObject(playerControllerClass);
 	}
 #endif
@@ -227,19 +271,20 @@ void Game::AddObject(OObject* object)
 
 	// Add object
 	m_activeObjects.emplace_back(object);
+	m_objectIndex.Add(object);
 	object->OnGameLoaded(this);
 	
 
 	// Add to look up table, if net synced
 	NetSession* session = GetSession();
 	if (session != nullptr && object->GetNetworkID() != 0)
-		m_netObjectLookup[object->GetNetworkID()] = object;
+		m_netObjectLookup.Set(object->GetNetworkID(), object);
 }
 
 template<>
 OObject* Game::SpawnObject(const SubClassOf<OObject>& objectClass, const OObject* owner)
 {
-	OObject* object = objectClass->New<OObject>();
+	OObject* object = objectClass->NewPooled<OObject>();
 	if (object == nullptr)
 		return nullptr;
 	if (owner != nullptr)
@@ -248,6 +293,16 @@ OObject* Game::SpawnObject(const SubClassOf<OObject>& objectClass, const OObject
 	return object;
 }
 
+void Game::RegisterSingleton(const SubClassOf<OObject>& objectClass)
+{
+	// Hasn't started yet
+	if (m_engine == nullptr)
+		m_singletonObjects.emplace(objectClass);
+	// Already started to just spawn it
+	else
+		SpawnObject(objectClass);
+}
+
 NetSession* Game::GetSession() const
 { 
 	return GetNetController()->GetSession(); 
@@ -261,8 +316,5 @@ NetController* Game::GetNetController() const
 
 OObject* Game::GetObjectByNetID(const uint32& id) const
 {
-	auto it = m_netObjectLookup.find(id);
-	if (it == m_netObjectLookup.end())
-		return nullptr;
-	return it->second;
+	return m_netObjectLookup.Find(id);
 }
\ No newline at end of file
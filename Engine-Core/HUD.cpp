@@ -1,6 +1,7 @@
-#include "Includes\Core\HUD.h"
-#include "Includes\Core\Engine.h"
-#include "Includes\Core\Game.h"
+#include "Includes/Core/HUD.h"
+#include "Includes/Core/Engine.h"
+#include "Includes/Core/Game.h"
+#include <algorithm>
 
 
 CLASS_SOURCE(AHUD, CORE_API)
@@ -24,6 +25,7 @@ void AHUD::OnTick(const float& deltaTime)
 {
 }
 
+#ifdef BUILD_CLIENT
 void AHUD::DisplayUpdate(sf::RenderWindow* window, const float& deltaTime)
 {
 	// Attempt to handle mouse events
@@ -31,28 +33,22 @@ void AHUD::DisplayUpdate(sf::RenderWindow* window, const float& deltaTime)
 		m_mouse.location = GetInputController()->GetMouseLocation();
 
 		// Update the mouse event state of all elements
+		// Go through layers from top to bottom (Elements are sorted by layer)
 		bool hit = false;
-		for (uint32 layer = 0; layer < 10; ++layer)
+		for (uint32 i = 0; i < m_elements.size(); ++i)
 		{
-			for (uint32 i = 0; i < m_elements.size(); ++i)
+			if (IsDestroyed())
+				return;
+
+			// Attempt to cast ray at topmost element
+			UGUIBase* elem = m_elements[m_elements.size() - i - 1];
+			if (!hit && elem->BlocksRaycasts() && elem->IntersectRay(m_mouse.location, window))
 			{
-				if (IsDestroyed())
-					return;
-
-				// Go through layers from top to bottom
-				UGUIBase* elem = m_elements[m_elements.size() - i - 1];
-				if (elem->GetDrawingLayer() == 9 - layer)
-				{
-					// Attempt to cast ray at topmost element
-					if (!hit && elem->BlocksRaycasts() && elem->IntersectRay(m_mouse.location, window))
-					{
-						elem->HandleMouseOver(m_mouse);
-						hit = true;
-					}
-					else
-						elem->HandleMouseMiss(m_mouse);
-				}
+				elem->HandleMouseOver(m_mouse);
+				hit = true;
 			}
+			else
+				elem->HandleMouseMiss(m_mouse);
 		}
 	}
 
@@ -68,27 +64,45 @@ void AHUD::DisplayUpdate(sf::RenderWindow* window, const float& deltaTime)
 	}
 
 
-	// TODO - Just store elements in layers to start with
-	for (uint32 layer = 0; layer < 10; ++layer)
-		for (uint32 i = 0; i < m_elements.size(); ++i)
-		{
-			if (IsDestroyed())
-				return;
+	// Draw from bottom layer up
+	for (uint32 i = 0; i < m_elements.size(); ++i)
+	{
+		if (IsDestroyed())
+			return;
 
-			UGUIBase* elem = m_elements[i];
-			if (elem->IsVisible() && elem->GetDrawingLayer() == layer)
-				elem->Draw(window, deltaTime);
-		}
+		UGUIBase* elem = m_elements[i];
+		if (elem->IsVisible())
+			elem->Draw(window, deltaTime);
+	}
 }
 
 UGUIBase* AHUD::AddElement(SubClassOf<UGUIBase> type)
 {
 	UGUIBase* gui = type->New<UGUIBase>();
-	m_elements.push_back(gui); 
+	InsertElement(gui);
 	gui->OnLoaded(this);
 	return gui;
 }
 
+void AHUD::OnElementLayerChanged(UGUIBase* element)
+{
+	auto it = std::find(m_elements.begin(), m_elements.end(), element);
+	if (it == m_elements.end())
+		return;
+
+	m_elements.erase(it);
+	InsertElement(element);
+}
+
+void AHUD::InsertElement(UGUIBase* element)
+{
+	auto it = std::upper_bound(m_elements.begin(), m_elements.end(), element,
+		[](const UGUIBase* a, const UGUIBase* b) { return a->GetDrawingLayer() < b->GetDrawingLayer(); }
+	);
+	m_elements.insert(it, element);
+}
+#endif
+
 const InputController* AHUD::GetInputController() const 
 { 
 	return GetGame()->GetEngine()->GetInputController(); 
@@ -0,0 +1,164 @@
+#include "Includes/Core/ImageKernels.h"
+#include <cstring>
+
+#if defined(_M_X64) || defined(__x86_64__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define KERNELS_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(KERNELS_SSE2) && (defined(_MSC_VER) || defined(__GNUC__))
+#define KERNELS_AVX2
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define TARGET_AVX2
+#else
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+
+void ImageKernels::Recolour(uint8* pixels, const size_t& pixelCount, const PaletteEntry* palette, const uint32& paletteSize)
+{
+	if (paletteSize == 0)
+		return;
+
+	static const bool bUseAVX2 = SupportsAVX2();
+	static const bool bUseSSE2 = SupportsSSE2();
+
+	if (bUseAVX2)
+		RecolourAVX2(pixels, pixelCount, palette, paletteSize);
+	else if (bUseSSE2)
+		RecolourSSE2(pixels, pixelCount, palette, paletteSize);
+	else
+		RecolourScalar(pixels, pixelCount, palette, paletteSize);
+}
+
+void ImageKernels::RecolourScalar(uint8* pixels, const size_t& pixelCount, const PaletteEntry* palette, const uint32& paletteSize)
+{
+	for (size_t i = 0; i < pixelCount; ++i)
+	{
+		uint32 pixel;
+		std::memcpy(&pixel, pixels + i * 4, 4);
+
+		for (uint32 p = 0; p < paletteSize; ++p)
+			if (pixel == palette[p].from)
+			{
+				std::memcpy(pixels + i * 4, &palette[p].to, 4);
+				break;
+			}
+	}
+}
+
+void ImageKernels::RecolourSSE2(uint8* pixels, const size_t& pixelCount, const PaletteEntry* palette, const uint32& paletteSize)
+{
+#ifdef KERNELS_SSE2
+	size_t i = 0;
+	for (; i + 4 <= pixelCount; i += 4)
+	{
+		__m128i* address = reinterpret_cast<__m128i*>(pixels + i * 4);
+		const __m128i original = _mm_loadu_si128(address);
+		__m128i result = original;
+
+		// Apply in reverse, so the first matching entry is the one left in place
+		for (uint32 p = paletteSize; p-- > 0;)
+		{
+			const __m128i mask = _mm_cmpeq_epi32(original, _mm_set1_epi32((int)palette[p].from));
+			result = _mm_or_si128(_mm_andnot_si128(mask, result), _mm_and_si128(mask, _mm_set1_epi32((int)palette[p].to)));
+		}
+
+		_mm_storeu_si128(address, result);
+	}
+
+	// Finish the remainder
+	RecolourScalar(pixels + i * 4, pixelCount - i, palette, paletteSize);
+#else
+	RecolourScalar(pixels, pixelCount, palette, paletteSize);
+#endif
+}
+
+#ifdef KERNELS_AVX2
+TARGET_AVX2 static void RecolourAVX2Impl(uint8* pixels, const size_t& pixelCount, const PaletteEntry* palette, const uint32& paletteSize)
+{
+	size_t i = 0;
+	for (; i + 8 <= pixelCount; i += 8)
+	{
+		__m256i* address = reinterpret_cast<__m256i*>(pixels + i * 4);
+		const __m256i original = _mm256_loadu_si256(address);
+		__m256i result = original;
+
+		// Apply in reverse, so the first matching entry is the one left in place
+		for (uint32 p = paletteSize; p-- > 0;)
+		{
+			const __m256i mask = _mm256_cmpeq_epi32(original, _mm256_set1_epi32((int)palette[p].from));
+			result = _mm256_blendv_epi8(result, _mm256_set1_epi32((int)palette[p].to), mask);
+		}
+
+		_mm256_storeu_si256(address, result);
+	}
+
+	// Finish the remainder
+	ImageKernels::RecolourSSE2(pixels + i * 4, pixelCount - i, palette, paletteSize);
+}
+#endif
+
+void ImageKernels::RecolourAVX2(uint8* pixels, const size_t& pixelCount, const PaletteEntry* palette, const uint32& paletteSize)
+{
+#ifdef KERNELS_AVX2
+	RecolourAVX2Impl(pixels, pixelCount, palette, paletteSize);
+#else
+	RecolourSSE2(pixels, pixelCount, palette, paletteSize);
+#endif
+}
+
+void ImageKernels::SplitMask(const uint8* pixels, const size_t& pixelCount, const uint32* colours, const uint32& colourCount, uint8* outBase, uint8* outMask)
+{
+	const uint32 transparent = 0;
+	for (size_t i = 0; i < pixelCount; ++i)
+	{
+		uint32 pixel;
+		std::memcpy(&pixel, pixels + i * 4, 4);
+
+		bool bIsMasked = false;
+		for (uint32 c = 0; c < colourCount && !bIsMasked; ++c)
+			bIsMasked = pixel == colours[c];
+
+		std::memcpy(outBase + i * 4, bIsMasked ? &transparent : &pixel, 4);
+		std::memcpy(outMask + i * 4, bIsMasked ? &pixel : &transparent, 4);
+	}
+}
+
+
+bool ImageKernels::SupportsSSE2()
+{
+#ifdef KERNELS_SSE2
+	return true;
+#else
+	return false;
+#endif
+}
+
+bool ImageKernels::SupportsAVX2()
+{
+#ifdef KERNELS_AVX2
+#ifdef _MSC_VER
+	int regs[4];
+	__cpuid(regs, 0);
+	if (regs[0] < 7)
+		return false;
+
+	// OS must save the AVX registers (OSXSAVE + XCR0 state)
+	__cpuid(regs, 1);
+	if ((regs[2] & (1 << 27)) == 0 || (_xgetbv(0) & 0x6) != 0x6)
+		return false;
+
+	__cpuidex(regs, 7, 0);
+	return (regs[1] & (1 << 5)) != 0;
+#else
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2");
+#endif
+#else
+	return false;
+#endif
+}
@@ -1,5 +1,6 @@
 #pragma once
 #include "Object.h"
+#include "RenderSnapshot.h"
 #include <SFML/Graphics.hpp>
 
 
@@ -12,14 +13,13 @@ class LLevel;
 */
 class CORE_API AActor : public OObject
 {
-	CLASS_BODY()
-	friend LLevel;
+	CLASS_BODY(OObject)
+	friend class LLevel;
 private:
 	static uint32 s_instanceCounter;
 	const uint32 m_instanceId;
 	LLevel* m_level = nullptr;
 
-	bool bIsBeingDrawn = false;
 	bool bIsActive = true;
 	bool bWasSpawnedWithLevel;
 
@@ -81,11 +81,11 @@ public:
 
 #ifdef BUILD_CLIENT
 	/**
-	* Called when this actor should be drawn to the screen
-	* @param window			The window to draw to
-	* @param deltaTime		Time since last draw in seconds)
+	* Called at the end of each logic tick to capture what this actor should draw
+	* (Called on the main thread, the display thread only ever sees the snapshot)
+	* @param snapshot		The snapshot to add any drawables to
 	*/
-	virtual void OnDraw(sf::RenderWindow* window, const float& deltaTime) {}
+	virtual void OnRender(RenderSnapshot& snapshot) {}
 #endif
 
 protected:
@@ -118,11 +118,11 @@ public:
 	inline void SetActive(const bool& active) { bIsActive = active; }
 	inline const bool& IsActive() const { return bIsActive; }
 
-	inline const bool& IsTickable() const { return bIsTickable && bIsActive; }
+	inline bool IsTickable() const { return bIsTickable && bIsActive; }
 	inline const bool& IsVisible() const { return bIsActive; }
 
 	inline const std::vector<KeyBinding*>& GetKeyBindings() const { return m_keyBindings; }
-	inline const bool& CanReceiveInput() const { return m_keyBindings.size() != 0; }
+	inline bool CanReceiveInput() const { return m_keyBindings.size() != 0; }
 
 	inline void SetLocation(const vec2& location) { m_desiredLocation = location; bLocationUpdated = true; }
 	inline void Translate(const vec2& amount) { m_desiredLocation += amount; bLocationUpdated = true; }
@@ -1,30 +1,32 @@
 #pragma once
 #include "Common.h"
+#include "TextureAtlas.h"
 
 #include <vector>
-#include <SFML\Graphics.hpp>
+#include <SFML/Graphics.hpp>
 
 
 /**
 * Holds a series of textures (In order) and lets them loop through at a set framerate
+* Sheets hold no playback state, so the frame is worked out from the time the caller has been playing for
 * -NOTE: Doesn't manage memory for given textures
 */
 class CORE_API AnimationSheet
 {
 private:
-	float m_timer = 0;
 	float m_frameDuration = 0.2f;
 
-	uint32 m_currentFrame = 0;
-	std::vector<const sf::Texture*> m_timeline;
+	std::vector<TextureRegion> m_timeline;
+	std::vector<TextureRegion> m_maskTimeline;
 
 public:
 	/**
-	* Updates the animation
-	* @param deltaTime			Time since last frame (In seconds)
+	* Work out which frame should be showing
+	* @param time			How long the animation has been playing for (In seconds)
+	* @returns The index of the frame
 	*/
-	void UpdateAnimation(const float& deltaTime);
-	
+	uint32 GetFrameIndex(const float& time) const;
+
 
 	/**
 	* Getters & Setters
@@ -32,11 +34,15 @@ public:
 public:
 	/**
 	* Adds frame to this animation sheet
-	* @param texture		The frame to add
+	* @param frame		The frame to add
+	* @param mask		Greyscale mask to be drawn over the frame, tinted by the user (Optional)
 	*/
-	inline void AddFrame(const sf::Texture* texture) { m_timeline.emplace_back(texture); }
-	inline const sf::Texture* GetCurrentFrame() const { return m_timeline[m_currentFrame]; }
-	inline const sf::Texture* GetFrame(uint32 index) const { return m_timeline[index]; }
+	inline void AddFrame(const TextureRegion& frame, const TextureRegion& mask = TextureRegion()) { m_timeline.emplace_back(frame); m_maskTimeline.emplace_back(mask); }
+	inline const TextureRegion& GetFrame(uint32 index) const { return m_timeline[index]; }
+	inline const TextureRegion& GetMask(uint32 index) const { return m_maskTimeline[index]; }
+	inline const TextureRegion& GetFrameAt(const float& time) const { return m_timeline[GetFrameIndex(time)]; }
+	inline const TextureRegion& GetMaskAt(const float& time) const { return m_maskTimeline[GetFrameIndex(time)]; }
+	inline uint32 GetFrameCount() const { return m_timeline.size(); }
 
 	inline void SetFrameDuration(const float& value) { m_frameDuration = value; }
 	inline const float& GetFrameDuration() const { return m_frameDuration; }
@@ -47,3 +53,44 @@ public:
 
 };
 
+
+/**
+* Playback state for a single user of a (Shared) animation sheet
+* Only stores when playback started, so nothing needs ticking and the frame is only worked out when it's drawn
+*/
+struct CORE_API AnimationPlayback
+{
+	const AnimationSheet* sheet = nullptr;
+	/// Animation clock time that playback started at
+	float startTime = 0.0f;
+	bool bIsPlaying = false;
+
+	/**
+	* Start playing from the first frame
+	* @param time			The current animation clock time
+	*/
+	inline void Play(const float& time) { startTime = time; bIsPlaying = true; }
+
+	/**
+	* Stop playing (Holds on the first frame)
+	*/
+	inline void Stop() { bIsPlaying = false; }
+
+	/**
+	* @param time			The current animation clock time
+	* @returns The index of the frame to show
+	*/
+	inline uint32 GetFrameIndex(const float& time) const { return bIsPlaying ? sheet->GetFrameIndex(time - startTime) : 0; }
+
+	/**
+	* @param time			The current animation clock time
+	* @returns The frame to show or an invalid region if there is no sheet
+	*/
+	inline TextureRegion GetFrame(const float& time) const { return sheet != nullptr ? sheet->GetFrame(GetFrameIndex(time)) : TextureRegion(); }
+
+	/**
+	* @param time			The current animation clock time
+	* @returns The mask to show or an invalid region if there is no sheet
+	*/
+	inline TextureRegion GetMask(const float& time) const { return sheet != nullptr ? sheet->GetMask(GetFrameIndex(time)) : TextureRegion(); }
+};
@@ -1,29 +1,70 @@
 #pragma once
 #include "Common.h"
 #include "AnimationSheet.h"
+#include "TextureAtlas.h"
 
+#include <vector>
 #include <unordered_map>
-#include <SFML\Graphics.hpp>
+#include <SFML/Graphics.hpp>
+
+
+/**
+* Handle to a registered asset, resolved once from its path, so lookups are just an index
+* (Types are kept separate, so a texture id cannot be used to fetch a font)
+*/
+template<typename AssetType>
+struct AssetID
+{
+	uint32 index = 0; // 0 - Reserved as invalid
+
+	AssetID() {}
+	explicit AssetID(const uint32& index) : index(index) {}
+
+	inline bool IsValid() const { return index != 0; }
+	inline bool operator==(const AssetID& other) const { return index == other.index; }
+	inline bool operator!=(const AssetID& other) const { return index != other.index; }
+};
+
+typedef AssetID<TextureRegion> TextureID;
+typedef AssetID<AnimationSheet> AnimationID;
+typedef AssetID<sf::Font> FontID;
 
 
 /**
 * Holds all assets, so that duplicates don't have to be made
+* Assets are looked up by path once, to fetch their id, and by id from then on
 */
 class CORE_API AssetController
 {
 private:
+	/// Standalone textures (Owned by this)
 	std::unordered_map<string, sf::Texture*> m_textures;
-	std::unordered_map<string, sf::Font*> m_fonts;
-	std::unordered_map<string, AnimationSheet*> m_animations;
+#ifdef BUILD_CLIENT
+	TextureAtlas m_atlas;
+#endif
+
+	/// Path key to id lookups (Only used by slow path)
+	std::unordered_map<string, TextureID> m_textureIds;
+	std::unordered_map<string, AnimationID> m_animationIds;
+	std::unordered_map<string, FontID> m_fontIds;
+
+	/// Assets indexed by id (Index 0 is left empty for invalid ids)
+	std::vector<TextureRegion> m_textureRegions;
+	std::vector<AnimationSheet*> m_animations;
+	std::vector<sf::Font*> m_fonts;
+
+	/// Shared clock that all animations are evaluated against
+	sf::Clock m_animationClock;
+
 public:
+	AssetController();
 	~AssetController();
 
 	/**
-	* Callback from engine for every tick by main
-	* @param engine			The engine + game to update using
-	* @param deltaTime		Time since last update (In seconds)
+	* Current time of the shared animation clock (Safe to call from any thread)
+	* @returns Time since the assets were created (In seconds)
 	*/
-	void HandleUpdate(const float& deltaTime);
+	inline float GetAnimationTime() const { return m_animationClock.getElapsedTime().asSeconds(); }
 
 
 	/**
@@ -31,57 +72,133 @@ public:
 	* @param path			URL to this texture
 	* @param isSmoothed		Should the texture enable smooth filter or not
 	* @param isRepeated		Should the texture repeat/tile
+	* @returns The id of the texture or an invalid id if failed
 	*/
-	void RegisterTexture(const string& path, bool isSmoothed = true, bool isRepeated = false);
+	TextureID RegisterTexture(const string& path, bool isSmoothed = true, bool isRepeated = false);
+#ifdef BUILD_CLIENT
 	/**
 	* Registers this texture (Forfeits memory rights over this texture to asset controller)
 	* @param path		URL to this texture
 	* @param texture	The texture to register
+	* @returns The id of the texture or an invalid id if failed
 	*/
-	void RegisterTexture(const string& path, sf::Texture* texture);
+	TextureID RegisterTexture(const string& path, sf::Texture* texture);
+#endif
 
 	/**
-	* Retreives a texture at this given path
+	* Retreives a standalone texture at this given path (Slow path)
 	* @param path		URL to the image file
-	* @returns The texture or nullptr if not registered
+	* @returns The texture or nullptr if not registered (Or if it was packed into the atlas)
 	*/
 	const sf::Texture* GetTexture(const string& path) const;
 
 
+	/**
+	* Loads and packs this texture into the shared atlas (Atlas textures are never smoothed or repeated)
+	* @param path			URL to this texture
+	* @returns The id of the texture or an invalid id if failed
+	*/
+	TextureID RegisterAtlasTexture(const string& path);
+#ifdef BUILD_CLIENT
+	/**
+	* Packs this image into the shared atlas (Atlas textures are never smoothed or repeated)
+	* @param path			URL to register this image under
+	* @param image			The image to pack
+	* @returns The id of the texture or an invalid id if failed
+	*/
+	TextureID RegisterAtlasTexture(const string& path, const sf::Image& image);
+#endif
+
+	/**
+	* Retreives the id of a texture at this given path (Slow path, so should be cached)
+	* @param path		URL to the image file
+	* @returns The id or an invalid id if not registered
+	*/
+	TextureID GetTextureID(const string& path) const;
+
+	/**
+	* Retreives the region of a texture at this given path (Slow path)
+	* (Works for both atlas and standalone textures, where standalone textures cover their whole texture)
+	* @param path		URL to the image file
+	* @returns The region or an invalid region if not registered
+	*/
+	inline const TextureRegion& GetTextureRegion(const string& path) const { return GetTextureRegion(GetTextureID(path)); }
+
+	/**
+	* Retreives the region of a texture from its id
+	* @param id			The id of the texture
+	* @returns The region or an invalid region if not registered
+	*/
+	inline const TextureRegion& GetTextureRegion(const TextureID& id) const { return id.index < m_textureRegions.size() ? m_textureRegions[id.index] : m_textureRegions[0]; }
+
+
 
 	/**
 	* Registers this animation sheet (Forfeits memory rights over this animation to asset controller)
 	* @param path			URL to this animation
 	* @param animation		The animation to register
+	* @returns The id of the animation or an invalid id if failed
+	*/
+	AnimationID RegisterAnimation(const string& path, AnimationSheet* animation);
+
+	/**
+	* Retreives the id of an animation at this given path (Slow path, so should be cached)
+	* @param path		URL to the animation file
+	* @returns The id or an invalid id if not registered
 	*/
-	void RegisterAnimation(const string& path, AnimationSheet* animation);
+	AnimationID GetAnimationID(const string& path) const;
 
 	/**
-	* Retreives a animation at this given path
+	* Retreives a animation at this given path (Slow path)
 	* @param path		URL to the animation file
 	* @returns The animation or nullptr if not registered
 	*/
-	const AnimationSheet* GetAnimation(const string& path) const;
+	inline const AnimationSheet* GetAnimation(const string& path) const { return GetAnimation(GetAnimationID(path)); }
+
+	/**
+	* Retreives a animation from its id
+	* @param id			The id of the animation
+	* @returns The animation or nullptr if not registered
+	*/
+	inline const AnimationSheet* GetAnimation(const AnimationID& id) const { return id.index < m_animations.size() ? m_animations[id.index] : nullptr; }
 
 
 
 	/**
 	* Loads and registers this font
 	* @param path			URL to this font
+	* @returns The id of the font or an invalid id if failed
 	*/
-	void RegisterFont(const string& path);
+	FontID RegisterFont(const string& path);
+#ifdef BUILD_CLIENT
 	/**
 	* Registers this font (Forfeits memory rights over this texture to asset controller)
 	* @param path		URL to this font
 	* @param font		The font to register
+	* @returns The id of the font or an invalid id if failed
 	*/
-	void RegisterFont(const string& path, sf::Font* font);
+	FontID RegisterFont(const string& path, sf::Font* font);
+#endif
 
 	/**
-	* Retreives a font at this given path
+	* Retreives the id of a font at this given path (Slow path, so should be cached)
+	* @param path		URL to the font file
+	* @returns The id or an invalid id if not registered
+	*/
+	FontID GetFontID(const string& path) const;
+
+	/**
+	* Retreives a font at this given path (Slow path)
 	* @param path		URL to the image file
 	* @returns The font or nullptr if not registered
 	*/
-	const sf::Font* GetFont(const string& path) const;
+	inline const sf::Font* GetFont(const string& path) const { return GetFont(GetFontID(path)); }
+
+	/**
+	* Retreives a font from its id
+	* @param id			The id of the font
+	* @returns The font or nullptr if not registered
+	*/
+	inline const sf::Font* GetFont(const FontID& id) const { return id.index < m_fonts.size() ? m_fonts[id.index] : nullptr; }
 };
 
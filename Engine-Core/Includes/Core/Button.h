@@ -11,7 +11,7 @@ typedef std::function<void()> ButtonCallback;
 */
 class CORE_API UButton : public ULabel
 {
-	CLASS_BODY()
+	CLASS_BODY(ULabel)
 private:
 	ButtonCallback m_callback;
 	bool bPressedOnThis = false;
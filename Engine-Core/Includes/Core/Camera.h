@@ -5,16 +5,15 @@
 
 class CORE_API ACamera : public AActor
 {
-	CLASS_BODY()
+	CLASS_BODY(AActor)
 public:
 	ACamera();
 
 #ifdef BUILD_CLIENT
 	/**
-	* Called when this entity should be drawn to the screen
-	* @param window			The window to draw to
-	* @param deltaTime		Time since last draw in seconds)
+	* Called at the end of each logic tick to capture what this actor should draw
+	* @param snapshot		The snapshot to add any drawables to
 	*/
-	virtual void OnDraw(sf::RenderWindow* window, const float& deltaTime) override;
+	virtual void OnRender(RenderSnapshot& snapshot) override;
 #endif
 };
\ No newline at end of file
@@ -0,0 +1,155 @@
+#pragma once
+#include "ManagedClass.h"
+#include <vector>
+#include <unordered_map>
+
+
+
+/**
+* View over every live entry of a class (And it's subclasses) held in a ClassIndex
+* Iterates by index, so entries added during iteration are safe and will also be visited
+*/
+template<class Type, class BaseType>
+class ClassRange
+{
+public:
+	class Iterator
+	{
+	private:
+		const std::vector<BaseType*>* m_entries;
+		uint32 m_index;
+
+	public:
+		Iterator(const std::vector<BaseType*>* entries, const uint32& index) :
+			m_entries(entries), m_index(index)
+		{
+			SkipDestroyed();
+		}
+
+		inline Type* operator*() const { return static_cast<Type*>((*m_entries)[m_index]); }
+		inline Iterator& operator++() { ++m_index; SkipDestroyed(); return *this; }
+
+		/// Compares against end, using the current size (As entries may be added while iterating)
+		inline bool operator!=(const Iterator& other) const { return IsAtEnd() != other.IsAtEnd() || (!IsAtEnd() && m_index != other.m_index); }
+		inline bool operator==(const Iterator& other) const { return !(*this != other); }
+
+		inline bool IsAtEnd() const { return m_entries == nullptr || m_index >= m_entries->size(); }
+
+	private:
+		inline void SkipDestroyed()
+		{
+			while (!IsAtEnd() && (*m_entries)[m_index]->IsDestroyed())
+				++m_index;
+		}
+	};
+
+private:
+	const std::vector<BaseType*>* m_entries;
+
+public:
+	ClassRange(const std::vector<BaseType*>* entries) : m_entries(entries) {}
+
+	inline Iterator begin() const { return Iterator(m_entries, 0); }
+	inline Iterator end() const { return Iterator(nullptr, 0); }
+
+	/**
+	* Get the first live entry in this range
+	* @returns The entry or nullptr, if the range is empty
+	*/
+	inline Type* First() const
+	{
+		Iterator it = begin();
+		return it.IsAtEnd() ? nullptr : *it;
+	}
+
+	/**
+	* Is there no live entry in this range
+	*/
+	inline bool IsEmpty() const { return begin().IsAtEnd(); }
+};
+
+
+/**
+* Lookup of objects by their class, where each object is stored under it's own class and every parent class
+* Allows type queries to touch only matching objects, without any casting or allocation
+*/
+template<class BaseType>
+class ClassIndex
+{
+private:
+	struct Bucket
+	{
+		std::vector<BaseType*> entries;
+		bool bIsDirty = false;
+	};
+	std::unordered_map<const MClass*, Bucket> m_buckets;
+	bool bIsDirty = false;
+
+public:
+	/**
+	* Add an entry under it's class and all parent classes
+	* @param entry			The entry to add
+	*/
+	inline void Add(BaseType* entry)
+	{
+		for (const MClass* type = entry->GetClass(); type != nullptr; type = type->GetParentClass())
+			m_buckets[type].entries.emplace_back(entry);
+	}
+
+	/**
+	* Flag that an entry of this class has been destroyed and must be removed on the next RemoveDestroyed
+	* @param type			The class of the destroyed entry
+	*/
+	inline void MarkDirty(const MClass* type)
+	{
+		for (; type != nullptr; type = type->GetParentClass())
+			m_buckets[type].bIsDirty = true;
+		bIsDirty = true;
+	}
+
+	/**
+	* Remove all destroyed entries from any flagged classes (Must be called before those entries are deleted)
+	*/
+	inline void RemoveDestroyed()
+	{
+		if (!bIsDirty)
+			return;
+
+		for (auto& it : m_buckets)
+		{
+			Bucket& bucket = it.second;
+			if (!bucket.bIsDirty)
+				continue;
+
+			uint32 keptCount = 0;
+			for (uint32 i = 0; i < bucket.entries.size(); ++i)
+				if (!bucket.entries[i]->IsDestroyed())
+					bucket.entries[keptCount++] = bucket.entries[i];
+			bucket.entries.resize(keptCount);
+			bucket.bIsDirty = false;
+		}
+		bIsDirty = false;
+	}
+
+	/**
+	* Remove every entry
+	*/
+	inline void Clear()
+	{
+		m_buckets.clear();
+		bIsDirty = false;
+	}
+
+	/**
+	* Get all live entries of this class (Including subclasses)
+	* @param type			The class to query for
+	*/
+	template<class Type>
+	inline ClassRange<Type, BaseType> Get(const MClass* type) const
+	{
+		auto it = m_buckets.find(type);
+		if (it == m_buckets.end())
+			return ClassRange<Type, BaseType>(nullptr);
+		return ClassRange<Type, BaseType>(&it->second.entries);
+	}
+};
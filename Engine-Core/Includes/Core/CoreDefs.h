@@ -3,10 +3,12 @@
 */
 #pragma once
 
+#if defined(_MSC_VER)
 #ifdef BUILD_CORE
 #define CORE_API __declspec(dllexport)
 #else
 #define CORE_API __declspec(dllimport)
 #endif
-
-#define Super __super
\ No newline at end of file
+#else
+#define CORE_API __attribute__((visibility("default")))
+#endif
@@ -12,7 +12,7 @@
 */
 class CORE_API DefaultNetLayer : public NetLayer
 {
-	CLASS_BODY()
+	CLASS_BODY(NetLayer)
 protected:
 	string m_password;
 
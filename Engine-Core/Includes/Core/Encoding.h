@@ -5,6 +5,7 @@
 #include "Common.h"
 #include "ByteBuffer.h"
 #include <memory>
+#include <cstring>
 
 
 // Let game override encoding, if they need to
@@ -16,7 +17,7 @@
 template<typename T>
 void Encode(ByteBuffer& buffer, const T& data)
 {
-	static_assert(false, "No encode implementation");
+	static_assert(sizeof(T) == 0, "No encode implementation");
 }
 
 template<>
@@ -138,7 +139,7 @@ inline void Encode<uvec2>(ByteBuffer& buffer, const uvec2& data)
 template<typename T>
 bool Decode(ByteBuffer& buffer, T& out, void* context = nullptr)
 {
-	static_assert(false, "No decode implementation");
+	static_assert(sizeof(T) == 0, "No decode implementation");
 	return false;
 }
 
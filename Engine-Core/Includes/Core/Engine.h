@@ -11,6 +11,15 @@
 
 
 class Game;
+class NetController;
+
+
+/**
+* How often load stats are logged, whilst enabled by -loadstats (In seconds)
+*/
+#ifndef ENGINE_LOAD_STATS_INTERVAL
+#define ENGINE_LOAD_STATS_INTERVAL 5.0f
+#endif
 
 
 /**
@@ -32,8 +41,28 @@ private:
 	uint32 m_mainTickRate = 50;
 	uint32 m_mainSleepRate = 1000 / m_mainTickRate;
 
+	/// Max players for the session opened on launch (0 leaves it to the session)
+	uint16 m_maxPlayerCount = 0;
+
+	/// Where to record the session opened on launch (Empty, if not recording)
+	string m_recordPath;
+	/// Replay to re-simulate instead of launching normally (Empty, if not replaying)
+	string m_replayPath;
+
+	/// Should tick time and bandwidth be logged periodically
+	bool bLogLoadStats = false;
+	float m_loadStatsTimer = 0.0f;
+	uint32 m_loadStatsTicks = 0;
+	float m_loadStatsTotalTime = 0.0f;
+	float m_loadStatsMaxTime = 0.0f;
+	uint64 m_loadStatsBytesSent = 0;
+	uint64 m_loadStatsBytesReceived = 0;
+
 #ifdef BUILD_CLIENT
 	sf::RenderWindow* m_renderWindow = nullptr;
+
+	/// Held whilst logic is running, so the display thread only touches live objects when it's safe to
+	sf::Mutex m_logicMutex;
 #endif
 
 public:
@@ -46,6 +75,19 @@ public:
 	*/
 	void Launch(Game* game);
 
+	/**
+	* Hook a game onto the engine without launching into the main loops
+	* The caller is then responsible for calling Tick (e.g. For headless bots driven by a harness)
+	* @param game		The game for the engine to run
+	*/
+	void Hook(Game* game);
+
+	/**
+	* Perform a single logic tick of the game and the network
+	* @param deltaTime	Time since last tick (In seconds)
+	*/
+	void Tick(const float& deltaTime);
+
 	/**
 	* Flags the engine to close itself
 	*/
@@ -57,6 +99,18 @@ private:
 	*/
 	void MainLoop();
 
+	/**
+	* Re-simulate the replay headlessly, as fast as possible, then log how long it took
+	*/
+	void ReplayLoop();
+
+	/**
+	* Record the time a main tick took and log the load stats, when due
+	* @param tickTime		How long the tick took (In seconds)
+	* @param deltaTime		Time since last tick (In seconds)
+	*/
+	void UpdateLoadStats(const float& tickTime, const float& deltaTime);
+
 #ifdef BUILD_CLIENT
 	/**
 	* The engine's main display loop
@@ -78,10 +132,13 @@ public:
 
 #ifdef BUILD_CLIENT
 	inline sf::RenderWindow* GetDisplayWindow() const { return m_renderWindow; }
+	inline sf::Mutex& GetLogicMutex() { return m_logicMutex; }
 #endif
 	inline Game* GetGame() const { return m_game; }
 	inline const Version& GetVersionNo() const { return m_version; }
 
+	inline bool IsReplaying() const { return !m_replayPath.empty(); }
+
 	inline NetController* GetNetController() const { return m_netController; }
 	inline InputController* GetInputController() const { return m_inputController; }
 
@@ -1,6 +1,7 @@
 #pragma once
 #include "Common.h"
 #include "ManagedClass.h"
+#include "TextureAtlas.h"
 #include <SFML/Graphics.hpp>
 
 
@@ -13,7 +14,7 @@ class AHUD;
 */
 class CORE_API UGUIBase : public ManagedObject
 {
-	CLASS_BODY()
+	CLASS_BODY(ManagedObject)
 public:
 	/// The canvas scale that everything will be based/scale on
 	static const vec2 s_canvasSize;
@@ -44,6 +45,7 @@ private:
 
 	Colour m_colour;
 	const sf::Texture* m_texture = nullptr;
+	sf::IntRect m_textureRect;
 	
 public:
 	UGUIBase();
@@ -132,13 +134,14 @@ protected:
 	*/
 public:
 	inline uint8 GetDrawingLayer() const { return m_drawingLayer; }
+	void SetDrawingLayer(const uint8& layer);
 	inline bool IsTickable() const { return bIsTickable && bIsActive; }
 
 	inline void SetActive(const bool& value) { bIsActive = value; }
 	inline const bool& IsActive() const { return bIsActive; }
 
 	inline void SetDisabled(const bool& value) { bIsDisabled = value; }
-	inline const bool& IsDisabled() const { return bIsDisabled || !bIsActive; }
+	inline bool IsDisabled() const { return bIsDisabled || !bIsActive; }
 
 	inline AHUD* GetHUD() const { return m_parent; }
 	inline bool IsMouseOver() const { return bMouseWasOver && bIsActive; }
@@ -168,6 +171,6 @@ public:
 	inline void SetColour(const Colour& value) { m_colour = value; }
 	inline const Colour& GetColour() const { return m_colour; }
 
-	inline void SetTexture(const sf::Texture* value) { m_texture = value; }
+	inline void SetTexture(const TextureRegion& value) { m_texture = value.texture; m_textureRect = value.rect; }
 	inline const sf::Texture* GetTexture() const { return m_texture; }
 };
\ No newline at end of file
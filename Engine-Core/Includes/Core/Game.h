@@ -8,6 +8,9 @@
 #include "Level.h"
 #include "Actor.h"
 #include "Object.h"
+#include "ClassIndex.h"
+#include "NetIdTable.h"
+#include "RenderSnapshot.h"
 
 #include "PlayerController.h"
 
@@ -19,6 +22,14 @@
 class Engine;
 
 
+/**
+* Max number of actors from a closed level which will be deleted each tick
+*/
+#ifndef LEVEL_TEARDOWN_BUDGET
+#define LEVEL_TEARDOWN_BUDGET 64
+#endif
+
+
 /**
 * Contains any relevent information about a given game
 * e.g. Assets to load, Supported actor types, Supported levels etc.
@@ -26,8 +37,8 @@ class Engine;
 class CORE_API Game
 {
 private:
-	friend NetSession;
-	friend NetRemoteSession;
+	friend class NetSession;
+	friend class NetRemoteSession;
 	string m_name;
 	Engine* m_engine = nullptr;
 	Version m_version;
@@ -35,6 +46,7 @@ private:
 	AssetController m_assetController;
 	LLevel* m_currentLevel = nullptr;
 	LLevel* m_desiredLevel = nullptr;
+	std::vector<LLevel*> m_closingLevels;
 
 	std::queue<SubClassOf<OObject>> m_singletonObjects;
 
@@ -43,7 +55,13 @@ private:
 	std::unordered_map<uint16, SubClassOf<AActor>> m_registeredActorTypes;
 
 	std::vector<OObject*> m_activeObjects;
-	std::unordered_map<uint16, OObject*> m_netObjectLookup;
+	ClassIndex<OObject> m_objectIndex;
+	NetIdTable<OObject> m_netObjectLookup;
+
+#ifdef BUILD_CLIENT
+	RenderSnapshotBuffer m_renderSnapshots;
+	SpriteBatch m_spriteBatch;
+#endif
 
 public:
 	/// Level to load at start (For client)
@@ -73,6 +91,11 @@ public:
 	void MainUpdate(const float& deltaTime);
 
 #ifdef BUILD_CLIENT
+	/**
+	* Callback from engine at the end of every logic tick, to capture what should be drawn
+	*/
+	void CaptureRenderSnapshot();
+
 	/**
 	* Callback from engine for every tick by display
 	* @param deltaTime		Time since last update (In seconds)
@@ -169,29 +192,13 @@ public:
 	*/
 	template<class ObjectType>
 	ObjectType* SpawnObject(const SubClassOf<ObjectType>& objectClass = ObjectType::StaticClass(), const OObject* owner = nullptr) { return static_cast<ObjectType*>(SpawnObject<OObject>(*objectClass, owner)); }
-	/**
-	* Spawns an object of the given type
-	* @param objectClass		The class of the object to spawn
-	* @param owner				The object who is seen as this object's owner
-	* @returns New object or nullptr, if invalid
-	*/
-	template<>
-	OObject* SpawnObject(const SubClassOf<OObject>& objectClass, const OObject* owner);
 
 
 	/**
 	* Registers this object as a singleton and will spawn it in, when ready
 	* @param objectClass			The type of object to spawn in
 	*/
-	inline void RegisterSingleton(const SubClassOf<OObject>& objectClass)
-	{
-		// Hasn't started yet
-		if (m_engine == nullptr)
-			m_singletonObjects.emplace(objectClass);
-		// Already started to just spawn it
-		else
-			SpawnObject(objectClass);
-	}
+	void RegisterSingleton(const SubClassOf<OObject>& objectClass);
 
 
 	/**
@@ -219,30 +226,13 @@ public:
 	* Return all active objects of this class
 	* @param type			The class type to query for
 	*/
-	inline const std::vector<OObject*> GetActiveObjects(const MClass* type) const
-	{
-		std::vector<OObject*> output;
-		for (uint32 i = 0; i < m_activeObjects.size(); ++i)
-			if (m_activeObjects[i]->GetClass()->IsChildOf(type) && !m_activeObjects[i]->IsDestroyed())
-				output.emplace_back(m_activeObjects[i]);
-		return output;
-	}
+	inline ClassRange<OObject, OObject> GetActiveObjects(const MClass* type) const { return m_objectIndex.Get<OObject>(type); }
 
 	/**
 	* Return all active objects of this class type
 	*/
 	template<class ObjectType>
-	inline const std::vector<ObjectType*> GetActiveObjects() const
-	{
-		std::vector<ObjectType*> output;
-		for (uint32 i = 0; i < m_activeObjects.size(); ++i)
-		{
-			ObjectType* casted = dynamic_cast<ObjectType*>(m_activeObjects[i]);
-			if (casted != nullptr && !casted->IsDestroyed())
-				output.emplace_back(casted);
-		}
-		return output;
-	}
+	inline ClassRange<ObjectType, OObject> GetActiveObjects() const { return m_objectIndex.Get<ObjectType>(ObjectType::StaticClass()); }
 
 	/**
 	* Get the first object of this type
@@ -251,12 +241,12 @@ public:
 	template<class ObjectType>
 	inline ObjectType* GetFirstObject(const bool& onlyOwned = false) const
 	{
-		for (uint32 i = 0; i < m_activeObjects.size(); ++i)
-		{
-			ObjectType* casted = dynamic_cast<ObjectType*>(m_activeObjects[i]);
-			if (casted != nullptr && (!onlyOwned || casted->IsNetOwner()) && !casted->IsDestroyed())
-				return casted;
-		}
+		if (!onlyOwned)
+			return GetActiveObjects<ObjectType>().First();
+
+		for (ObjectType* object : GetActiveObjects<ObjectType>())
+			if (object->IsNetOwner())
+				return object;
 		return nullptr;
 	}
 
@@ -267,4 +257,13 @@ public:
 	* @returns The object of this id or nullptr, if not found
 	*/
 	OObject* GetObjectByNetID(const uint32& id) const;
-};
\ No newline at end of file
+};
+
+/**
+* Spawns an object of the given type
+* @param objectClass		The class of the object to spawn
+* @param owner				The object who is seen as this object's owner
+* @returns New object or nullptr, if invalid
+*/
+template<>
+OObject* Game::SpawnObject<OObject>(const SubClassOf<OObject>& objectClass, const OObject* owner);
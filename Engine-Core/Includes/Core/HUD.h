@@ -22,8 +22,9 @@ struct MouseContainer
 */
 class CORE_API AHUD : public AActor
 {
-	CLASS_BODY()
+	CLASS_BODY(AActor)
 private:
+	/// All elements, sorted by drawing layer (Elements within a layer are kept in the order they were added)
 	std::vector<UGUIBase*> m_elements;
 	MouseContainer m_mouse;
 
@@ -33,6 +34,7 @@ public:
 
 	virtual void OnTick(const float& deltaTime) override;
 
+#ifdef BUILD_CLIENT
 	/**
 	* Called after all actors have been drawn
 	* @param window			The window to draw to
@@ -55,6 +57,21 @@ public:
 	template<class Type>
 	inline Type* AddElement() { return static_cast<Type*>(AddElement(Type::StaticClass())); }
 
+	/**
+	* Callback for when an element has changed drawing layer, so it can be moved to the correct place
+	* @param element		The element in question
+	*/
+	void OnElementLayerChanged(UGUIBase* element);
+
+private:
+	/**
+	* Insert an element after all others on the same or lower layers
+	* @param element		The element to insert
+	*/
+	void InsertElement(UGUIBase* element);
+public:
+#endif
+
 	/**
 	* Getters & Setters
 	*/
@@ -0,0 +1,58 @@
+#pragma once
+#include "Common.h"
+
+
+/**
+* Maps one exact RGBA colour to another
+* Colours are packed in memory order (R in the lowest byte), to match raw RGBA pixel buffers
+*/
+struct PaletteEntry
+{
+	uint32 from;
+	uint32 to;
+
+	PaletteEntry() : from(0), to(0) {}
+	PaletteEntry(const Colour& from, const Colour& to) : from(Pack(from)), to(Pack(to)) {}
+
+	static inline uint32 Pack(const Colour& colour) { return (uint32)colour.r | ((uint32)colour.g << 8) | ((uint32)colour.b << 16) | ((uint32)colour.a << 24); }
+};
+
+
+/**
+* Bulk operations over raw RGBA pixel buffers
+* Recolour picks the widest instruction set the CPU supports (AVX2, SSE2 or scalar) the first time it is called
+*/
+class CORE_API ImageKernels
+{
+public:
+	/**
+	* Replace every pixel exactly matching a palette entry's source colour with that entry's target colour
+	* Every pixel is visited once, and only compared against its original colour (So entries never chain)
+	* @param pixels			Raw RGBA pixels (4 bytes per pixel, row-major)
+	* @param pixelCount		Number of pixels in the buffer
+	* @param palette		Colour mappings (If sources repeat, the first entry wins)
+	* @param paletteSize	Number of entries in the palette
+	*/
+	static void Recolour(uint8* pixels, const size_t& pixelCount, const PaletteEntry* palette, const uint32& paletteSize);
+
+	/// Individual implementations of Recolour (Exposed for benchmarks, only call if supported)
+	static void RecolourScalar(uint8* pixels, const size_t& pixelCount, const PaletteEntry* palette, const uint32& paletteSize);
+	static void RecolourSSE2(uint8* pixels, const size_t& pixelCount, const PaletteEntry* palette, const uint32& paletteSize);
+	static void RecolourAVX2(uint8* pixels, const size_t& pixelCount, const PaletteEntry* palette, const uint32& paletteSize);
+
+	/**
+	* Split pixels into those exactly matching any of the given colours and everything else, in a single pass
+	* @param pixels			Raw RGBA pixels (4 bytes per pixel, row-major)
+	* @param pixelCount		Number of pixels in the buffer
+	* @param colours		Packed colours which belong to the mask (See PaletteEntry::Pack)
+	* @param colourCount	Number of colours
+	* @param outBase		Where to write the pixels not in the mask (Transparent where the mask is)
+	* @param outMask		Where to write the pixels in the mask (Transparent everywhere else)
+	*/
+	static void SplitMask(const uint8* pixels, const size_t& pixelCount, const uint32* colours, const uint32& colourCount, uint8* outBase, uint8* outMask);
+
+	/** Can the SSE2 version be used on this CPU */
+	static bool SupportsSSE2();
+	/** Can the AVX2 version be used on this CPU (And OS) */
+	static bool SupportsAVX2();
+};
@@ -1,6 +1,6 @@
 #pragma once
 #include "Types.h"
-#include <SFML\Graphics.hpp>
+#include <SFML/Graphics.hpp>
 
 
 /**
@@ -14,7 +14,7 @@ typedef std::function<void(string)> FieldCallback;
 */
 class CORE_API UInputField : public ULabel
 {
-	CLASS_BODY()
+	CLASS_BODY(ULabel)
 private:
 	static UInputField* s_currentFocus;
 	FieldCallback m_callback;
@@ -4,7 +4,7 @@
 
 class CORE_API ULabel : public UGUIBase
 {
-	CLASS_BODY()
+	CLASS_BODY(UGUIBase)
 public:
 	enum HorizontalAlignment
 	{
@@ -1,6 +1,8 @@
 #pragma once
 #include "ManagedClass.h"
 #include "Actor.h"
+#include "ClassIndex.h"
+#include "NetIdTable.h"
 #include <vector>
 #include <unordered_map>
 
@@ -17,10 +19,11 @@ class Game;
 */
 class CORE_API LLevel : public ManagedObject
 {
-	CLASS_BODY()
+	CLASS_BODY(ManagedObject)
 	friend class NetSession;
 	friend class NetHostSession;
 	friend class NetRemoteSession;
+	friend class NetReplaySession;
 private:
 	static uint16 s_instanceCounter;
 	uint16 m_instanceId;
@@ -30,9 +33,9 @@ private:
 	bool bIsDestroying = false;
 
 	std::vector<AActor*> m_activeActors;
-	std::unordered_map<uint16, AActor*> m_netActorLookup;
-
-	std::vector<AActor*> m_drawnActors;
+	ClassIndex<AActor> m_actorIndex;
+	NetIdTable<AActor> m_netActorLookup;
+	std::unordered_map<uint32, AActor*> m_instanceActorLookup;
 
 protected:
 	/// Class type to use for the level controller
@@ -62,7 +65,13 @@ public:
 
 #ifdef BUILD_CLIENT
 	/**
-	* Callback from engine for every tick by display
+	* Capture all visible actors into a snapshot, to be drawn by the display thread
+	* @param snapshot		The snapshot to fill
+	*/
+	void Render(RenderSnapshot& snapshot);
+
+	/**
+	* Callback from engine for every tick by display (Draws the HUD, so logic must not be running)
 	* @param window			The window to draw to
 	* @param deltaTime		Time since last update (In seconds)
 	*/
@@ -71,8 +80,14 @@ public:
 
 	/** Builds the level by adding any actors */
 	void Build();
-	/** Cleans up the level */
+	/** Begins cleaning up the level (Actors are deleted over the following calls to HandleDestroy) */
 	void Destroy();
+	/**
+	* Delete actors belonging to this level, after Destroy has been called
+	* @param maxCount		The most actors to delete during this call
+	* @returns True once every actor has been deleted, and the level itself is safe to delete
+	*/
+	bool HandleDestroy(const uint32& maxCount);
 
 	/**
 	* Add an actor to the level (Forfeits memory rights to level)
@@ -81,14 +96,11 @@ public:
 	void AddActor(AActor* actor);
 
 	/**
-	* Spawns an actor into the level of the given type
-	* @param actorClass			The class of the actor to spawn
-	* @param location			Location to spawn the actor at
-	* @param owner				The object who is seen as this object's owner
-	* @returns New actor object or nullptr, if invalid
+	* Make room for a batch of actors which are about to be added (e.g. When receiving the initial sync of a level)
+	* @param count		The number of actors expected
 	*/
-	template<class ActorType>
-	ActorType* SpawnActor(const SubClassOf<AActor>& actorClass = ActorType::StaticClass(), const OObject* owner = nullptr) { return static_cast<ActorType*>(SpawnActor<AActor>(*actorClass, owner)); }
+	void ReserveActors(const uint32& count);
+
 	/**
 	* Spawns an actor into the level of the given type
 	* @param actorClass			The class of the actor to spawn
@@ -96,8 +108,8 @@ public:
 	* @param owner				The object who is seen as this object's owner
 	* @returns New actor object or nullptr, if invalid
 	*/
-	template<>
-	AActor* SpawnActor(const SubClassOf<AActor>& actorClass, const OObject* owner);
+	template<class ActorType>
+	ActorType* SpawnActor(const SubClassOf<AActor>& actorClass = ActorType::StaticClass(), const OObject* owner = nullptr) { return static_cast<ActorType*>(SpawnActor<AActor>(*actorClass, owner)); }
 
 protected:
 	/**
@@ -132,29 +144,12 @@ public:
 	* Return all active actors of this class
 	* @param type			The class type to query for
 	*/
-	inline const std::vector<AActor*> GetActiveActors(const MClass* type) const 
-	{
-		std::vector<AActor*> output;
-		for (uint32 i = 0; i < m_activeActors.size(); ++i)
-			if (m_activeActors[i]->GetClass()->IsChildOf(type) && !m_activeActors[i]->IsDestroyed())
-				output.emplace_back(m_activeActors[i]);
-		return output;
-	}
+	inline ClassRange<AActor, AActor> GetActiveActors(const MClass* type) const { return m_actorIndex.Get<AActor>(type); }
 	/**
 	* Return all active actors of this class type
 	*/
 	template<class ActorType>
-	inline const std::vector<ActorType*> GetActiveActors() const 
-	{
-		std::vector<ActorType*> output;
-		for (uint32 i = 0; i < m_activeActors.size(); ++i)
-		{
-			ActorType* casted = dynamic_cast<ActorType*>(m_activeActors[i]);
-			if (casted != nullptr && !casted->IsDestroyed())
-				output.emplace_back(casted);
-		}
-		return output;
-	}
+	inline ClassRange<ActorType, AActor> GetActiveActors() const { return m_actorIndex.Get<ActorType>(ActorType::StaticClass()); }
 
 	/**
 	* Get the first actor of this type
@@ -163,12 +158,12 @@ public:
 	template<class ActorType>
 	inline ActorType* GetFirstActor(const bool& onlyOwned = false) const
 	{
-		for (uint32 i = 0; i < m_activeActors.size(); ++i)
-		{
-			ActorType* casted = dynamic_cast<ActorType*>(m_activeActors[i]);
-			if (casted != nullptr && (!onlyOwned || casted->IsNetOwner()) && !casted->IsDestroyed())
-				return casted;
-		}
+		if (!onlyOwned)
+			return GetActiveActors<ActorType>().First();
+
+		for (ActorType* actor : GetActiveActors<ActorType>())
+			if (actor->IsNetOwner())
+				return actor;
 		return nullptr;
 	}
 
@@ -186,4 +181,14 @@ public:
 	* @returns The actor of this id or nullptr, if not found
 	*/
 	AActor* GetActorByNetID(const uint32& id) const;
-};
\ No newline at end of file
+};
+
+/**
+* Spawns an actor into the level of the given type
+* @param actorClass			The class of the actor to spawn
+* @param location			Location to spawn the actor at
+* @param owner				The object who is seen as this object's owner
+* @returns New actor object or nullptr, if invalid
+*/
+template<>
+AActor* LLevel::SpawnActor<AActor>(const SubClassOf<AActor>& actorClass, const OObject* owner);
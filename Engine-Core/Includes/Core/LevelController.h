@@ -10,7 +10,7 @@
 */
 class CORE_API ALevelController : public AActor
 {
-	CLASS_BODY()
+	CLASS_BODY(AActor)
 public:
 	ALevelController();
 
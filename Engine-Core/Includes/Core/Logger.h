@@ -1,59 +1,109 @@
 #pragma once
 #include "CoreDefs.h"
 #include <string>
+#include <cstdio>
 
 
 #define MAX_LOG_MSG 4096
 
+/**
+* How many records can be waiting to be written, before callers have to wait for the writer (Must be a power of 2)
+*/
+#ifndef LOG_QUEUE_SIZE
+#define LOG_QUEUE_SIZE 256
+#endif
+
+/**
+* How long the writer thread sleeps for when there is nothing to write (In ms)
+*/
+#ifndef LOG_FLUSH_INTERVAL
+#define LOG_FLUSH_INTERVAL 5
+#endif
+
+
+/**
+* Log levels, where any level below LOG_MIN_LEVEL is compiled out entirely
+*/
+#define LOG_LEVEL_MESSAGE	0
+#define LOG_LEVEL_WARNING	1
+#define LOG_LEVEL_ERROR		2
+
+#ifndef LOG_MIN_LEVEL
+#define LOG_MIN_LEVEL LOG_LEVEL_MESSAGE
+#endif
 
-#define LOG(message, ...) { \
-	static char fmsg[MAX_LOG_MSG]; \
-	snprintf(fmsg, sizeof(fmsg), message, __VA_ARGS__); \
-	Logger::LogMessage(fmsg); \
-}
 
 #ifdef BUILD_DEBUG
-#define LOG_WARNING(message, ...) { \
-	static char fmsg[MAX_LOG_MSG]; \
-	snprintf(fmsg, sizeof(fmsg), message, __VA_ARGS__); \
-	Logger::LogWarning(fmsg, __FILE__, __LINE__); \
-}
-
-#define LOG_ERROR(message, ...) { \
-	static char fmsg[MAX_LOG_MSG]; \
-	snprintf(fmsg, sizeof(fmsg), message, __VA_ARGS__); \
-	Logger::LogError(fmsg, __FILE__, __LINE__); \
-}
+#define LOG_SOURCE __FILE__, __LINE__
 #else
-#define LOG_WARNING(message, ...) { \
-	static char fmsg[MAX_LOG_MSG]; \
-	snprintf(fmsg, sizeof(fmsg), message, __VA_ARGS__); \
-	Logger::LogWarning(fmsg); \
-}
+#define LOG_SOURCE nullptr, 0
+#endif
 
-#define LOG_ERROR(message, ...) { \
-	static char fmsg[MAX_LOG_MSG]; \
-	snprintf(fmsg, sizeof(fmsg), message, __VA_ARGS__); \
-	Logger::LogError(fmsg); \
-}
+#if LOG_MIN_LEVEL <= LOG_LEVEL_MESSAGE
+#define LOG(message, ...) Logger::Log(Logger::Level::Message, nullptr, 0, message, ##__VA_ARGS__)
+#else
+#define LOG(message, ...) ((void)0)
+#endif
+
+#if LOG_MIN_LEVEL <= LOG_LEVEL_WARNING
+#define LOG_WARNING(message, ...) Logger::Log(Logger::Level::Warning, LOG_SOURCE, message, ##__VA_ARGS__)
+#else
+#define LOG_WARNING(message, ...) ((void)0)
+#endif
+
+#if LOG_MIN_LEVEL <= LOG_LEVEL_ERROR
+#define LOG_ERROR(message, ...) Logger::Log(Logger::Level::Error, LOG_SOURCE, message, ##__VA_ARGS__)
+#else
+#define LOG_ERROR(message, ...) ((void)0)
 #endif
 
 
 /**
 * Centralized logging class
+* Messages are formatted by the calling thread straight into a lock-free queue, then written out in batches by a background thread
+* (Before Start and after Shutdown, messages are written immediately by the calling thread instead)
 * NOTE: All text output should be through this class (preferably by use of LOG(_XYZ) macros)
 */
 class CORE_API Logger
 {
 public:
-	static void LogMessage(std::string msg);
+	enum class Level : unsigned char
+	{
+		Message = LOG_LEVEL_MESSAGE,
+		Warning = LOG_LEVEL_WARNING,
+		Error = LOG_LEVEL_ERROR
+	};
+
+	/**
+	* Launch the background writer thread
+	*/
+	static void Start();
+
+	/**
+	* Write out anything still queued and stop the background writer thread
+	*/
+	static void Shutdown();
+
+	/**
+	* Format and queue a message to be written
+	* @param level			The level of this message
+	* @param file			The source file this was logged from (Optional)
+	* @param line			The source line this was logged from
+	* @param format			printf style format string
+	*/
+	static void Log(const Level& level, const char* file, const int& line, const char* format, ...)
+#ifdef __GNUC__
+		__attribute__((format(printf, 4, 5)))
+#endif
+		;
+
+	static void LogMessage(const std::string& msg);
 
 #ifdef BUILD_DEBUG
-	static void LogWarning(std::string msg, std::string file, int line);
-	static void LogError(std::string msg, std::string file, int line);
+	static void LogWarning(const std::string& msg, const char* file, int line);
+	static void LogError(const std::string& msg, const char* file, int line);
 #else
-	static void LogWarning(std::string msg);
-	static void LogError(std::string msg);
+	static void LogWarning(const std::string& msg);
+	static void LogError(const std::string& msg);
 #endif
 };
-
@@ -1,5 +1,6 @@
 #pragma once
 #include "Common.h"
+#include <vector>
 
 
 
@@ -16,6 +17,14 @@
 #define __UNIQUE_ID__ (__ID_START__ + __COUNTER__)
 
 
+/**
+* Max number of freed instances each class will hold on to for reuse
+*/
+#ifndef CLASS_POOL_SIZE
+#define CLASS_POOL_SIZE 256
+#endif
+
+
 
 /**
 * Managed class, an easily accessible class factory 
@@ -28,8 +37,17 @@ private:
 	string m_name;
 	const uint16 m_id;
 
+	/// Freed instance memory, which can be reused by NewPooled
+	mutable std::vector<void*> m_instancePool;
+
+	/// Position of this class in the pre-order numbering of the class tree (0 if not yet numbered)
+	uint32 m_hierarchyIndex = 0;
+	/// Last position used by any subclass of this class in the numbering
+	uint32 m_hierarchyLast = 0;
+
 public:
 	MClass(const char* name);
+	virtual ~MClass();
 
 	/**
 	* Generates a new object of this class type
@@ -48,6 +66,58 @@ public:
 		return static_cast<Type*>(NewObject(dst));
 	}
 
+	/**
+	* Generates a new object of this class type, reusing the memory of a previously pooled instance where possible
+	* (Objects made this way may still be deleted normally, their memory will just not be reused)
+	* @returns New object or nullptr, if this class cannot be constructed
+	*/
+	template<class Type>
+	inline Type* NewPooled() const
+	{
+		void* memory = AllocateInstance();
+		Type* object = New<Type>(memory);
+		if (object == nullptr && memory != nullptr)
+			ReleaseInstance(memory);
+		return object;
+	}
+
+	/**
+	* Destroys an object and returns its memory to the pool of its class
+	* @param object			The object to delete (Must have been allocated by new or NewPooled)
+	*/
+	template<class Type>
+	static inline void DeletePooled(Type* object)
+	{
+		if (object == nullptr)
+			return;
+
+		const MClass* type = object->GetClass();
+		void* memory = dynamic_cast<void*>(object);
+		object->~Type();
+		type->ReleaseInstance(memory);
+	}
+
+	/**
+	* The size of a single instance of this class
+	* @returns Size in bytes or 0, if this class cannot be constructed
+	*/
+	virtual uint32 GetInstanceSize() const;
+
+private:
+	/**
+	* Fetch memory for a single instance from the pool or heap
+	* @returns The memory to construct at or nullptr, if this class cannot be constructed
+	*/
+	void* AllocateInstance() const;
+
+	/**
+	* Return the memory of a destructed instance to the pool
+	* @param memory			The memory which the instance was constructed at
+	*/
+	void ReleaseInstance(void* memory) const;
+
+public:
+
 	/**
 	* Get the parent class of this class
 	* @returns The parent class, if exists or nullptr
@@ -62,6 +132,12 @@ public:
 	*/
 	bool IsChildOf(const MClass* other, const bool& trueIfIdentical = true) const;
 
+	/**
+	* Number every constructed class by its position in the class tree, so IsChildOf becomes a range check
+	* Classes constructed after this has been called will fall back to walking up their parents until rebuilt
+	*/
+	static void BuildHierarchy();
+
 
 	/**
 	* Getters & Setters
@@ -111,8 +187,8 @@ public:
 
 /**
 * A child of this class, will have a managed class automatically generated for it through the following macros:
-* -CLASS_BODY() as the first line in the class decleration
-* -CLASS_SOURCE(<Class Name>, <Parent Class Name>, <API>) in the translation file (cpp)
+* -CLASS_BODY(<Parent Class Name>) as the first line in the class decleration
+* -CLASS_SOURCE(<Class Name>, <API>) in the translation file (cpp) (API may be omitted outside of core)
 * This object should also implement a default parameterless constructor that will be called by the class during construction
 * -NOTE: Never inherit from multiple (children of) ManagedObject classes
 */
@@ -134,9 +210,11 @@ public:
 
 /**
 * Generates required function signatures for managed objects
+* Super is declared here, so parent calls don't rely on compiler specific extensions
 */
-#define CLASS_BODY() \
+#define CLASS_BODY(ParentClass) \
 public: \
+	typedef ParentClass Super; \
 	static const MClass* StaticClass(); \
 	static const MClass* ParentStaticClass(); \
 	virtual const MClass* GetClass(); \
@@ -146,8 +224,8 @@ private:
 /**
 * Generates the required MClass and function content for Managed objects
 */
-#define CLASS_SOURCE(ClassName, API) \
-class API ClassName ## _Class : public MClass \
+#define CLASS_SOURCE(ClassName, ...) \
+class __VA_ARGS__ ClassName ## _Class : public MClass \
 { \
 private: \
 	friend class ClassName; \
@@ -156,6 +234,7 @@ private: \
 	ClassName ## _Class() : MClass(#ClassName) {} \
 \
 	virtual ManagedObject* NewObject(void* dst = nullptr) const { return dst == nullptr ? new ClassName : new(dst) ClassName; } \
+	virtual uint32 GetInstanceSize() const { return sizeof(m_refObj); } \
 \
 	virtual const MClass* GetParentClass() const { return ClassName::ParentStaticClass(); } \
 public: \
@@ -163,5 +242,5 @@ public: \
 }; \
 \
 const MClass* ClassName::StaticClass() { static ClassName ## _Class sc; return &sc; } \
-const MClass* ClassName::ParentStaticClass() { return __super::StaticClass(); } \
+const MClass* ClassName::ParentStaticClass() { return Super::StaticClass(); } \
 const MClass* ClassName::GetClass() { return ClassName::StaticClass(); } 
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include "NetSocketUdp.h"
 #include "NetSession.h"
 #include "NetLayer.h"
+#include "NetTransport.h"
 
 
 #include <list>
@@ -24,11 +25,14 @@ class CORE_API NetController
 private:
 	NetIdentity m_localIdentity;
 	NetIdentity m_publicIdentity;
+	bool bHasPublicIdentity = false;
 
 	std::list<NetSocket*> m_activeSockets;
 	const Engine* m_engine = nullptr;
 
 	NetSession* m_activeSession = nullptr;
+	/// What new sessions talk through (nullptr uses real sockets)
+	NetTransport* m_transport = nullptr;
 
 public:
 	NetController(const Engine* engine);
@@ -70,6 +74,13 @@ public:
 	*/
 	bool JoinSession(const NetIdentity& remote, ConfigLayer configLayer = ConfigLayer());
 
+	/**
+	* Attempt to open a session which re-simulates a recorded match (Must be called before the game is hooked)
+	* @param path			The replay to play
+	* @returns If the replay is successfully opened
+	*/
+	bool ReplaySession(const string& path);
+
 
 	/**
 	* Getters and setters
@@ -77,8 +88,18 @@ public:
 public:
 	inline NetSession* GetSession() const { return m_activeSession; }
 
+	/**
+	* Set what any new sessions should talk through (Not owned by this controller, so must outlive any sessions)
+	*/
+	inline void SetTransport(NetTransport* transport) { m_transport = transport; }
+	inline NetTransport* GetTransport() const { return m_transport; }
+
 	inline const NetIdentity& GetLocalIdentity() const { return m_localIdentity; }
-	inline const NetIdentity& GetPublicIdentity() const { return m_publicIdentity; }
+
+	/**
+	* Fetch the public identity of this machine (Resolved on first call, as it requires a request to an external server)
+	*/
+	const NetIdentity& GetPublicIdentity();
 };
 
 
@@ -1,5 +1,7 @@
 #pragma once
 #include "NetSession.h"
+#include "NetReplay.h"
+#include <map>
 
 
 /**
@@ -33,8 +35,12 @@ private:
 	std::map<const NetIdentity, NetPlayerConnection*> m_connectionLookup;
 	const float m_maxInactivityTime = 15.0f;
 
+	/// Where this session's inputs are being recorded (nullptr, if not recording)
+	NetReplayWriter* m_replay = nullptr;
+	uint32 m_replayNetTicks = 0;
+
 public:
-	NetHostSession(Game* game, const NetIdentity identity);
+	NetHostSession(Game* game, const NetIdentity identity, NetTransport* transport = nullptr);
 	virtual ~NetHostSession();
 
 	/**
@@ -43,6 +49,26 @@ public:
 	*/
 	virtual bool Start() override;
 
+	/**
+	* Start recording everything this session decodes into a replay, so the match can be re-simulated later
+	* Should be called before the game is hooked, as any existing players or state won't be recorded
+	* @param path			Where to write the replay
+	* @param engineVersion	Version of the engine running this session (Stored, so replays only play back on a matching build)
+	* @returns If the replay file was opened
+	*/
+	bool StartRecording(const string& path, const Version& engineVersion);
+
+	/**
+	* Stop recording and close the replay file
+	*/
+	void StopRecording();
+
+	/**
+	* Callback from engine for every tick by main loop
+	* @param deltaTime		Time since last update (In seconds)
+	*/
+	virtual void MainUpdate(const float& deltaTime) override;
+
 	/**
 	* Callback every time there should be a network update (IO to be polled/pushed)
 	* @param deltaTime		Time since last update (In seconds)
@@ -79,6 +105,8 @@ private:
 	* Getters & Setters
 	*/
 public:
+	inline bool IsRecording() const { return m_replay != nullptr; }
+
 	inline uint32 GetPlayerCount() const
 	{
 #ifdef BUILD_CLIENT
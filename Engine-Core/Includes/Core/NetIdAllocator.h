@@ -0,0 +1,62 @@
+#pragma once
+#include "Common.h"
+#include <deque>
+#include <vector>
+
+
+/**
+* Hands out network ids, recycling released ids once they have sat in quarantine for a while
+* (Quarantine stops late packets for a deleted object being applied to whichever object next receives its id)
+* Released ids are reused before new ones are made, so the id space stays dense
+*/
+class CORE_API NetIdAllocator
+{
+private:
+	struct ReleasedID
+	{
+		uint16	id;
+		float	releaseTime;
+	};
+
+	uint16 m_nextId = 1; // 0 - Reserved as nullptr
+	bool bIsExhausted = false;
+
+	std::deque<ReleasedID> m_quarantine;
+	/// Which ids are currently in quarantine (Indexed by id)
+	std::vector<bool> m_isReleased;
+	float m_quarantineDuration;
+	float m_time = 0.0f;
+
+public:
+	NetIdAllocator(const float& quarantineDuration = 5.0f);
+
+	/**
+	* Advance the quarantine clock
+	* @param deltaTime		Time since last update (In seconds)
+	*/
+	void HandleUpdate(const float& deltaTime);
+
+	/**
+	* Fetch an id which is not in use
+	* @returns The new id or 0, if every id is currently in use
+	*/
+	uint16 New();
+
+	/**
+	* Return an id, so it may be reused after the quarantine period
+	* (Ignored, if the id is already in quarantine, so it can never be handed out twice)
+	* @param id				The id which is no longer in use
+	*/
+	void Release(const uint16& id);
+
+
+	/**
+	* Getters & Setters
+	*/
+public:
+	inline void SetQuarantineDuration(const float& duration) { m_quarantineDuration = duration; }
+	inline const float& GetQuarantineDuration() const { return m_quarantineDuration; }
+
+	/** Number of ids currently waiting to be reused */
+	inline uint32 GetReleasedCount() const { return m_quarantine.size(); }
+};
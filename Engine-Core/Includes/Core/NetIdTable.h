@@ -0,0 +1,86 @@
+#pragma once
+#include "Common.h"
+#include <vector>
+#include <algorithm>
+
+
+
+/**
+* Lookup of net synced objects by their network id
+* Ids are small and handed out densely, so they index straight into a table of slots
+*/
+template<class Type>
+class NetIdTable
+{
+private:
+	std::vector<Type*> m_slots;
+	uint32 m_count = 0;
+
+public:
+	/**
+	* Store an object under this id (Replacing anything previously stored there)
+	* @param id				The network id of the object
+	* @param object			The object to store
+	*/
+	inline void Set(const uint16& id, Type* object)
+	{
+		if (id >= m_slots.size())
+			m_slots.resize(id + 1, nullptr);
+
+		Type*& slot = m_slots[id];
+		if (slot == nullptr && object != nullptr)
+			++m_count;
+		else if (slot != nullptr && object == nullptr)
+			--m_count;
+		slot = object;
+	}
+
+	/**
+	* Remove an object from this id (Ignored, if the id is now used by a different object)
+	* @param id				The network id of the object
+	* @param object			The object which should be removed
+	*/
+	inline void Remove(const uint16& id, const Type* object)
+	{
+		if (id >= m_slots.size())
+			return;
+
+		Type*& slot = m_slots[id];
+		if (slot == nullptr || slot != object)
+			return;
+
+		slot = nullptr;
+		--m_count;
+	}
+
+	/**
+	* Retrieve the object currently using this id
+	* @param id				The network id to look up
+	* @returns The object or nullptr, if the id is unused
+	*/
+	inline Type* Find(const uint32& id) const
+	{
+		return id < m_slots.size() ? m_slots[id] : nullptr;
+	}
+
+	/**
+	* Make sure ids up to this value can be stored without growing the table
+	*/
+	inline void Reserve(const uint32& maxId)
+	{
+		if (maxId >= m_slots.size())
+			m_slots.resize(maxId + 1, nullptr);
+	}
+
+	/**
+	* Remove every object
+	*/
+	inline void Clear()
+	{
+		std::fill(m_slots.begin(), m_slots.end(), nullptr);
+		m_count = 0;
+	}
+
+	inline const uint32& Count() const { return m_count; }
+	inline bool IsEmpty() const { return m_count == 0; }
+};
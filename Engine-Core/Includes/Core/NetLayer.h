@@ -51,7 +51,7 @@ class OPlayerController;
 */
 class CORE_API NetLayer : public ManagedObject
 {
-	CLASS_BODY()
+	CLASS_BODY(ManagedObject)
 private:
 	Game* m_game;
 	NetSession* m_session;
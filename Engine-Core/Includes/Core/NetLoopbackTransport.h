@@ -0,0 +1,193 @@
+#pragma once
+#include "NetTransport.h"
+
+#include <map>
+#include <random>
+
+
+class NetLoopbackTransport;
+
+
+/**
+* Conditions applied to every packet sent over a loopback transport
+*/
+struct CORE_API NetLoopbackSettings
+{
+	/// How long each packet takes to arrive (In seconds)
+	float latency = 0.0f;
+	/// Random extra delay added to each packet, up to this (In seconds)
+	float jitter = 0.0f;
+	/// Chance of each UDP packet being dropped (0-1, TCP is never dropped)
+	float lossRate = 0.0f;
+	/// How many bytes per second each socket can send (0 for unlimited)
+	uint32 bandwidth = 0;
+	/// Seed for the jitter and loss, so runs can be repeated exactly
+	uint32 seed = 0;
+};
+
+
+/**
+* A packet which is travelling through a loopback transport
+*/
+struct CORE_API NetLoopbackPacket
+{
+	NetIdentity		source;
+	ByteBuffer		buffer;
+	/// When the packet will arrive (In transport time)
+	double			arrivalTime;
+	/// Order the packet was sent in (Breaks ties between arrivals)
+	uint64			sequence;
+};
+
+
+/**
+* Socket which passes packets through a loopback transport in memory, rather than over the network
+*/
+class CORE_API NetSocketLoopback : public NetSocket
+{
+	friend class NetLoopbackTransport;
+private:
+	NetLoopbackTransport* m_transport;
+	/// The identity this socket is bound to (Where packets sent to this socket go)
+	NetIdentity m_localIdentity;
+	bool bIsBound = false;
+
+	/// Packets sent to this socket, by arrival time
+	std::vector<NetLoopbackPacket> m_inbox;
+	/// When this socket will be free to send again (Only used when bandwidth is limited)
+	double m_linkFreeTime = 0.0;
+	/// The last arrival time of packets sent to each destination (TCP arrives in order)
+	std::map<NetIdentity, double> m_lastArrival;
+
+public:
+	NetSocketLoopback(NetLoopbackTransport* transport, const SocketType& type);
+	virtual ~NetSocketLoopback();
+
+	/**
+	* Polls the socket attempting to retrieve any packets which have arrived
+	* @param outPackets			Where to store all of the resulting packets
+	* @returns If the poll is successful and there is packets to process
+	*/
+	virtual bool Poll(std::vector<RawNetPacket>& outPackets);
+
+	/**
+	* Attempt to send data through this socket
+	* @param data		Pointer to data to send
+	* @param count		The size of data to send
+	* @param identity	Destination identity
+	* @returns Has the data been successfully sent (UDP packets may still be lost)
+	*/
+	virtual bool SendTo(const uint8* data, uint32 count, NetIdentity identity);
+
+	/**
+	* Try to close this socket
+	*/
+	virtual bool Close();
+
+	/**
+	* Open this socket as a listener
+	* @param identity	The identity to bind onto
+	* @returns Whether this successfully opens or not
+	*/
+	virtual bool Listen(NetIdentity identity);
+
+	/**
+	* Open a connect to the given destination (TCP will fail if nothing is listening)
+	*/
+	virtual bool Connect(NetIdentity identity);
+
+	/**
+	* Open a connection to the given destination, bound to a desired identity (Any free port, if 0)
+	*/
+	virtual bool ConnectAs(NetIdentity target, NetIdentity asIdentity);
+
+	/**
+	* Return the local identity that this socket is using (Same as identity, if listener)
+	*/
+	virtual NetIdentity GetLocalIdentity();
+
+private:
+	/**
+	* Queue a packet which has been sent to this socket
+	*/
+	void Receive(NetLoopbackPacket& packet);
+};
+
+
+/**
+* Transport which carries packets between sockets in this process, with simulated latency, jitter, loss and bandwidth
+* Time only moves when advanced, so the same seed and calls will always give the same deliveries
+* -NOTE: Main thread only
+*/
+class CORE_API NetLoopbackTransport : public NetTransport
+{
+	friend class NetSocketLoopback;
+private:
+	NetLoopbackSettings m_settings;
+	std::mt19937 m_random;
+
+	double m_time = 0.0;
+	uint64 m_sequence = 0;
+	uint16 m_portCounter;
+
+	/// Every bound socket, by type and identity
+	std::map<std::pair<SocketType, NetIdentity>, NetSocketLoopback*> m_sockets;
+
+	uint64 m_packetsSent = 0;
+	uint64 m_packetsDropped = 0;
+
+public:
+	NetLoopbackTransport(const NetLoopbackSettings& settings = NetLoopbackSettings());
+	virtual ~NetLoopbackTransport();
+
+	virtual NetSocket* BuildSocket(const SocketType& type) override;
+
+	/**
+	* Move the transport's clock forwards, so any packets due by then can be polled
+	* @param deltaTime		How far to move (In seconds)
+	*/
+	inline void Advance(const float& deltaTime) { m_time += deltaTime; }
+
+private:
+	/**
+	* Bind a socket onto this identity
+	* @param socket			The socket to bind
+	* @param identity		The identity to bind to (Any free port, if 0)
+	* @returns If the identity was free
+	*/
+	bool Bind(NetSocketLoopback* socket, NetIdentity identity);
+
+	/**
+	* Release the identity a socket is bound to
+	*/
+	void Unbind(NetSocketLoopback* socket);
+
+	/**
+	* @returns The socket bound to this identity (Or nullptr if none)
+	*/
+	NetSocketLoopback* Find(const SocketType& type, const NetIdentity& identity) const;
+
+	/**
+	* Send a packet between two sockets, applying the current conditions
+	* @param source			The sending socket
+	* @param target			The receiving socket
+	* @param data			Pointer to the data to send
+	* @param count			The size of data to send
+	*/
+	void Transmit(NetSocketLoopback* source, NetSocketLoopback* target, const uint8* data, const uint32& count);
+
+
+	/**
+	* Getters & Setters
+	*/
+public:
+	inline const NetLoopbackSettings& GetSettings() const { return m_settings; }
+	/// Change the conditions for any packets sent from now (Doesn't reseed)
+	inline void SetSettings(const NetLoopbackSettings& settings) { m_settings = settings; }
+
+	/// Current transport time (In seconds)
+	inline const double& GetTime() const { return m_time; }
+
+	inline const uint64& GetPacketsSent() const { return m_packetsSent; }
+	inline const uint64& GetPacketsDropped() const { return m_packetsDropped; }
+};
@@ -0,0 +1,127 @@
+#pragma once
+#include "Common.h"
+#include "NetSocket.h"
+#include <vector>
+
+
+class MClass;
+
+
+/**
+* How often the profiler logs a report, whilst enabled (In seconds)
+*/
+#ifndef NET_PROFILE_REPORT_INTERVAL
+#define NET_PROFILE_REPORT_INTERVAL 10.0f
+#endif
+
+/**
+* How many entries are shown in each report
+*/
+#ifndef NET_PROFILE_REPORT_SIZE
+#define NET_PROFILE_REPORT_SIZE 10
+#endif
+
+
+/**
+* What part of an object's net data the bytes were spent on
+*/
+enum class NetProfileKind : uint8
+{
+	Header		= 0,	// Object method, ids and counts
+	SyncVar		= 1,
+	RPC			= 2,
+};
+
+
+/**
+* Bytes and counts attributed to a single sync var, RPC or object header
+*/
+struct NetProfileEntry
+{
+	const MClass*	classType;
+	NetProfileKind	kind;
+	uint16			index;		// The sync var or RPC index (0 for headers)
+	SocketType		socket;
+
+	uint64			bytes = 0;
+	uint32			count = 0;
+};
+
+
+/**
+* Attributes encoded replication bytes to the class, sync var/RPC and socket responsible
+* so the worst offenders can be found (Totals are kept since the last Reset)
+* -NOTE: Main thread only
+*/
+class CORE_API NetProfiler
+{
+private:
+	static bool bIsEnabled;
+
+public:
+	/**
+	* Start recording
+	*/
+	static void Enable();
+
+	/**
+	* Stop recording (Keeps what was recorded, so it can still be queried)
+	*/
+	static void Disable();
+
+	/**
+	* Clear all recorded totals
+	*/
+	static void Reset();
+
+	/**
+	* Attribute encoded bytes
+	* @param classType		The class of the object which was encoded
+	* @param kind			What the bytes were spent on
+	* @param index			The sync var or RPC index
+	* @param socket			The socket the bytes will be sent over
+	* @param bytes			How many bytes were encoded
+	*/
+	static void Record(const MClass* classType, const NetProfileKind& kind, const uint16& index, const SocketType& socket, const uint32& bytes);
+
+	/**
+	* Callback from session for every tick by main, to log periodic reports
+	* @param deltaTime		Time since last update (In seconds)
+	*/
+	static void HandleUpdate(const float& deltaTime);
+
+	/**
+	* Log the most expensive entries since the last report
+	* @param count			How many entries to show
+	*/
+	static void LogReport(const uint32& count = NET_PROFILE_REPORT_SIZE);
+
+
+	/**
+	* Getters & Setters
+	*/
+public:
+	static inline bool IsEnabled() { return bIsEnabled; }
+
+	/**
+	* @returns Every entry, most bytes first
+	*/
+	static std::vector<NetProfileEntry> GetEntries();
+
+	/**
+	* @param classType		The class to query for
+	* @returns Every entry for this class, most bytes first
+	*/
+	static std::vector<NetProfileEntry> GetEntries(const MClass* classType);
+
+	/**
+	* @param classType		The class to query for
+	* @returns Total bytes encoded for this class
+	*/
+	static uint64 GetClassBytes(const MClass* classType);
+
+	/**
+	* @returns Total bytes encoded for every class
+	*/
+	static uint64 GetTotalBytes();
+};
@@ -22,7 +22,7 @@ private:
 	const float m_maxInactivityTime = 15.0f;
 
 public:
-	NetRemoteSession(Game* game, const NetIdentity identity);
+	NetRemoteSession(Game* game, const NetIdentity identity, NetTransport* transport = nullptr);
 	virtual ~NetRemoteSession();
 
 	/**
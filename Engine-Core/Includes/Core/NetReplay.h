@@ -0,0 +1,235 @@
+#pragma once
+#include "Common.h"
+#include "ByteBuffer.h"
+#include "Encoding.h"
+#include "Version.h"
+#include "NetSocket.h"
+
+#include <fstream>
+
+
+#define NET_REPLAY_MAGIC 0x4E52504C
+#define NET_REPLAY_VERSION 1
+
+/**
+* How many main ticks are buffered before being appended to the replay file
+*/
+#ifndef NET_REPLAY_FLUSH_TICKS
+#define NET_REPLAY_FLUSH_TICKS 50
+#endif
+
+/**
+* How many net ticks between each state checksum written into the replay (0 to disable)
+*/
+#ifndef NET_REPLAY_CHECKSUM_INTERVAL
+#define NET_REPLAY_CHECKSUM_INTERVAL 30
+#endif
+
+
+/**
+* The kinds of records which make up a replay (After the header)
+*/
+enum class NetReplayRecord : uint8
+{
+	Tick		= 0,	// Main tick (deltaTime)
+	Connect		= 1,	// Player accepted (ownerId, netId, initial sync vars)
+	Disconnect	= 2,	// Player removed (ownerId)
+	TcpUpdate	= 3,	// Update from a player, about to be decoded (ownerId, buffer)
+	UdpUpdate	= 4,	// Update from a player, about to be decoded (ownerId, buffer)
+	Checksum	= 5,	// Checksum of the state at the end of a net tick
+};
+
+
+/**
+* Everything needed to put a fresh game into the same state as the host, when it started recording
+*/
+struct CORE_API NetReplayHeader
+{
+	Version engineVersion;
+	Version gameVersion;
+
+	/// What the global rand was seeded with
+	uint32	seed = 0;
+	/// Net ticks per second of the session
+	uint32	tickRate = 0;
+	uint16	maxPlayerCount = 0;
+	/// The level class the session opened on
+	uint16	levelClass = 0;
+	/// Next instance id a level would be given
+	uint16	levelInstanceCounter = 0;
+	string	sessionName;
+};
+
+template<>
+inline void Encode<NetReplayHeader>(ByteBuffer& buffer, const NetReplayHeader& data)
+{
+	Encode<uint32>(buffer, NET_REPLAY_MAGIC);
+	Encode<uint16>(buffer, NET_REPLAY_VERSION);
+	Encode<Version>(buffer, data.engineVersion);
+	Encode<Version>(buffer, data.gameVersion);
+	Encode<uint32>(buffer, data.seed);
+	Encode<uint32>(buffer, data.tickRate);
+	Encode<uint16>(buffer, data.maxPlayerCount);
+	Encode<uint16>(buffer, data.levelClass);
+	Encode<uint16>(buffer, data.levelInstanceCounter);
+	Encode<string>(buffer, data.sessionName);
+}
+
+template<>
+inline bool Decode<NetReplayHeader>(ByteBuffer& buffer, NetReplayHeader& out, void* context)
+{
+	uint32 magic;
+	uint16 version;
+
+	return
+		Decode<uint32>(buffer, magic) && magic == NET_REPLAY_MAGIC &&
+		Decode<uint16>(buffer, version) && version == NET_REPLAY_VERSION &&
+		Decode<Version>(buffer, out.engineVersion) &&
+		Decode<Version>(buffer, out.gameVersion) &&
+		Decode<uint32>(buffer, out.seed) &&
+		Decode<uint32>(buffer, out.tickRate) &&
+		Decode<uint16>(buffer, out.maxPlayerCount) &&
+		Decode<uint16>(buffer, out.levelClass) &&
+		Decode<uint16>(buffer, out.levelInstanceCounter) &&
+		Decode<string>(buffer, out.sessionName);
+}
+
+
+/**
+* Appends a host's inputs (Tick timings, connections and player updates) to a replay file
+* Records are buffered and appended every few ticks, so a crash only loses the last moments
+*/
+class CORE_API NetReplayWriter
+{
+private:
+	std::ofstream m_file;
+	string m_path;
+	ByteBuffer m_buffer;
+
+	uint32 m_pendingTicks = 0;
+	uint64 m_bytesWritten = 0;
+
+public:
+	~NetReplayWriter();
+
+	/**
+	* Create the replay file and write the header
+	* @param path			Where to write the replay (Overwrites any existing file)
+	* @param header			The starting state of the host
+	* @returns If the file could be opened
+	*/
+	bool Open(const string& path, const NetReplayHeader& header);
+
+	/**
+	* Write any buffered records and close the file
+	*/
+	void Close();
+
+	/**
+	* Append any buffered records onto the file
+	*/
+	void Flush();
+
+	/**
+	* Record the start of a main tick
+	* @param deltaTime		Time since last tick (In seconds)
+	*/
+	void WriteTick(const float& deltaTime);
+
+	/**
+	* Record a player being accepted by the host
+	* @param ownerId		The player's network owner id
+	* @param netId			The player controller's network id
+	* @param state			The player controller's encoded sync vars
+	* @param count			The size of the encoded sync vars
+	*/
+	void WriteConnect(const uint16& ownerId, const uint16& netId, const uint8* state, const uint32& count);
+
+	/**
+	* Record a player being removed by the host
+	* @param ownerId		The player's network owner id
+	*/
+	void WriteDisconnect(const uint16& ownerId);
+
+	/**
+	* Record an update received from a player
+	* @param ownerId		The player's network owner id
+	* @param buffer			The update, flipped ready to be decoded
+	* @param socketType		The socket type the update arrived on
+	*/
+	void WriteUpdate(const uint16& ownerId, const ByteBuffer& buffer, const SocketType& socketType);
+
+	/**
+	* Record the checksum of the host's state
+	*/
+	void WriteChecksum(const uint32& checksum);
+
+
+	/**
+	* Getters & Setters
+	*/
+public:
+	inline bool IsOpen() const { return m_file.is_open(); }
+	inline const string& GetPath() const { return m_path; }
+	inline uint64 GetBytesWritten() const { return m_bytesWritten + m_buffer.Size(); }
+};
+
+
+/**
+* Reads back a replay file written by NetReplayWriter
+*/
+class CORE_API NetReplayReader
+{
+private:
+	ByteBuffer m_buffer;
+	NetReplayHeader m_header;
+
+public:
+	/**
+	* Load the replay file and read the header
+	* @param path			Where to read the replay from
+	* @returns If the file exists and has a valid header
+	*/
+	bool Open(const string& path);
+
+	/**
+	* Read which record comes next
+	* @param outRecord		Where to store the record type
+	* @returns False, if there are no records left
+	*/
+	bool Next(NetReplayRecord& outRecord);
+
+	/**
+	* Check which record comes next, without reading it
+	* @param outRecord		Where to store the record type
+	* @returns False, if there are no records left
+	*/
+	bool Peek(NetReplayRecord& outRecord) const;
+
+	/** Read the rest of each record (After Next has returned its type) */
+	bool ReadTick(float& outDeltaTime);
+	bool ReadConnect(uint16& outOwnerId, uint16& outNetId, ByteBuffer& outState);
+	bool ReadDisconnect(uint16& outOwnerId);
+	bool ReadUpdate(uint16& outOwnerId, ByteBuffer& outBuffer);
+	bool ReadChecksum(uint32& outChecksum);
+
+	/**
+	* Stop reading, ignoring any records which are left
+	*/
+	inline void Close() { m_buffer.Clear(); }
+
+private:
+	/**
+	* Stop reading, as the file ends part way through a record (e.g. The host crashed before it could flush)
+	* @returns false
+	*/
+	bool Truncated();
+
+
+	/**
+	* Getters & Setters
+	*/
+public:
+	inline const NetReplayHeader& GetHeader() const { return m_header; }
+	inline bool IsFinished() const { return m_buffer.Size() == 0; }
+};
@@ -0,0 +1,76 @@
+#pragma once
+#include "NetHostSession.h"
+#include "NetReplay.h"
+#include <map>
+
+
+/**
+* Re-simulates a match recorded by a NetHostSession, without any sockets
+* Acts as the host, but takes its players and their updates from the replay rather than the network
+* -NOTE: Must be started before the game is hooked, so the game starts in the same state as the recording
+*/
+class CORE_API NetReplaySession : public NetSession
+{
+private:
+	const string m_path;
+	const Version m_engineVersion;
+	NetReplayReader m_reader;
+
+	/// Players by the owner id they were recorded with
+	std::map<uint16, NetPlayerConnection*> m_connectionLookup;
+
+	uint32 m_tickCount = 0;
+	uint32 m_checksumsMatched = 0;
+	uint32 m_checksumsFailed = 0;
+	bool bIsInStep = true;
+	/// The first tick the replay was found to be out of step on
+	uint32 m_desyncTick = 0;
+
+public:
+	NetReplaySession(Game* game, const string& path, const Version& engineVersion);
+	virtual ~NetReplaySession();
+
+	/**
+	* Load the replay and put the game into the state the recording started in
+	* @returns If the replay could be loaded and was recorded by a matching build
+	*/
+	virtual bool Start() override;
+
+	/**
+	* Move onto the next recorded main tick
+	* @param outDeltaTime	Where to store the time the tick took on the host (In seconds)
+	* @returns False, once the replay has finished
+	*/
+	bool NextTick(float& outDeltaTime);
+
+	/**
+	* Callback every time there should be a network update (Applies everything the host decoded this net update)
+	* @param deltaTime		Time since last update (In seconds)
+	*/
+	virtual void NetUpdate(const float& deltaTime) override;
+
+private:
+	/**
+	* Apply a record which has just been read
+	* @param record			The type of record to apply
+	*/
+	void ApplyRecord(const NetReplayRecord& record);
+
+	/**
+	* Note that the replay no longer matches the recording
+	* @param reason			What didn't match
+	*/
+	void OnDesync(const string& reason);
+
+
+	/**
+	* Getters & Setters
+	*/
+public:
+	inline const uint32& GetTickCount() const { return m_tickCount; }
+	inline const uint32& GetChecksumsMatched() const { return m_checksumsMatched; }
+	inline const uint32& GetChecksumsFailed() const { return m_checksumsFailed; }
+
+	inline const bool& IsInStep() const { return bIsInStep; }
+	inline const uint32& GetDesyncTick() const { return m_desyncTick; }
+};
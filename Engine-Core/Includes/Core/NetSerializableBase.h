@@ -6,6 +6,12 @@
 #include "Encoding.h"
 #include "ByteBuffer.h"
 #include "NetSocket.h"
+#include "NetProfiler.h"
+#include <cstring>
+
+
+class NetSession;
+class MClass;
 
 
 /**
@@ -143,6 +149,7 @@ private:
 	friend class NetSession;
 	friend class NetHostSession;
 	friend class NetRemoteSession;
+	friend class NetReplaySession;
 	friend class Game;
 	friend class LLevel;
 
@@ -265,8 +272,9 @@ private:
 	* @param targetNetId	The net id of where this data will be sent to
 	* @param buffer			The buffer to fill with all this information
 	* @param socketType		The socket type this will be sent over
+	* @param profileClass	The class to attribute the encoded bytes to (For NetProfiler)
 	*/
-	void EncodeRPCRequests(const uint16& targetNetId, ByteBuffer& buffer, const SocketType& socketType);
+	void EncodeRPCRequests(const uint16& targetNetId, ByteBuffer& buffer, const SocketType& socketType, const MClass* profileClass);
 	/**
 	* Decode all RPC calls in this queue
 	* @param sourceNetId	The net id of where this data came from
@@ -281,8 +289,9 @@ private:
 	* @param buffer			The buffer to fill with all this information
 	* @param socketType		The socket type this will be sent over
 	* @param forceEncode	Forcefully encode all variables
+	* @param profileClass	The class to attribute the encoded bytes to (For NetProfiler)
 	*/
-	void EncodeSyncVarRequests(const uint16& targetNetId, ByteBuffer& buffer, const SocketType& socketType, const bool& forceEncode);
+	void EncodeSyncVarRequests(const uint16& targetNetId, ByteBuffer& buffer, const SocketType& socketType, const bool& forceEncode, const MClass* profileClass);
 	/**
 	* Decode all sync var calls in this queue
 	* @param sourceNetId	The net id of where this data came from
@@ -321,7 +330,7 @@ public:
 #define RPC_INDEX_HEADER(func, outInfo) \
 	const char*& __TEMP_NAME = func; \
 	RPCInfo& __TEMP_INFO = outInfo; \
-	if(__super::RegisterRPCs(__TEMP_NAME, __TEMP_INFO)) return true; 
+	if(Super::RegisterRPCs(__TEMP_NAME, __TEMP_INFO)) return true; 
 
 /**
 * Placed after RPC_INDEX_HEADER in ExecuteRPC to create an entry for a function
@@ -347,7 +356,7 @@ public:
 	uint16& __TEMP_INDEX = index; \
 	uint32& __TEMP_TRACK = trackIndex; \
 	const bool& __TEMP_FORCE_ENCODE = forceEncode; \
-	__super::RegisterSyncVars(__TEMP_QUEUE, __TEMP_SOCKET, __TEMP_INDEX, __TEMP_TRACK, __TEMP_FORCE_ENCODE);
+	Super::RegisterSyncVars(__TEMP_QUEUE, __TEMP_SOCKET, __TEMP_INDEX, __TEMP_TRACK, __TEMP_FORCE_ENCODE);
 
 /**
 * Placed after SYNCVAR_INDEX_HEADER in ExecuteSyncVar to create an entry for a variable
@@ -389,7 +398,7 @@ public:
 #define RPC_EXEC_HEADER(id, params) \
 	uint16& __TEMP_ID = id; \
 	ByteBuffer& __TEMP_BUFFER = params; \
-	if(__super::ExecuteRPC(__TEMP_ID, __TEMP_BUFFER)) return true;
+	if(Super::ExecuteRPC(__TEMP_ID, __TEMP_BUFFER)) return true;
 
 /**
 * Execution for a function at the placed index
@@ -509,7 +518,7 @@ public:
 	uint16& __TEMP_ID = id; \
 	ByteBuffer& __TEMP_BUFFER = value; \
 	const bool& __TEMP_SKIP_CALLBACKS = skipCallbacks; \
-	if(__super::ExecuteSyncVar(__TEMP_ID, __TEMP_BUFFER, __TEMP_SKIP_CALLBACKS)) return true;
+	if(Super::ExecuteSyncVar(__TEMP_ID, __TEMP_BUFFER, __TEMP_SKIP_CALLBACKS)) return true;
 
 /**
 * Execution for a variable at the placed index
@@ -1,17 +1,19 @@
 #pragma once
 #include "Common.h"
 
-#include "NetSocketTcp.h"
-#include "NetSocketUdp.h"
+#include "NetTransport.h"
 
 #include "Object.h"
 #include "Actor.h"
 #include "PlayerController.h"
 
 #include "NetLayer.h"
+#include "NetIdAllocator.h"
+#include "NetTrace.h"
 
 
 class Game;
+class LLevel;
 struct NetPlayerConnection;
 
 
@@ -46,16 +48,18 @@ private:
 	Game* m_game;
 
 	uint16 m_playerIdCounter;
-	uint16 m_objectNetIdCounter;
-	uint16 m_actorNetIdCounter;
+	NetIdAllocator m_objectIdAllocator;
+	NetIdAllocator m_actorIdAllocator;
 
 	uint32 m_tickRate = 30;
 	float m_sleepRate = 1.0f / (float)m_tickRate;
 	float m_tickTimer = 0.0f;
+	/// When the trace was last dumped for a spike (From NetTrace::Now)
+	uint64 m_lastTraceDump = 0;
 
 protected:
-	NetSocketTcp m_TcpSocket;
-	NetSocketUdp m_UdpSocket;
+	NetSocket* m_TcpSocket;
+	NetSocket* m_UdpSocket;
 
 	NetLayer* m_netLayer;
 	uint16 m_sessionNetId;
@@ -68,7 +72,7 @@ protected:
 	std::vector<NetObjectDeletion> m_deletionQueue;
 
 public:
-	NetSession(Game* game, const NetIdentity identity);
+	NetSession(Game* game, const NetIdentity identity, NetTransport* transport = nullptr);
 	virtual ~NetSession();
 
 	/**
@@ -88,7 +92,7 @@ public:
 	* Callback from engine for every tick by main loop
 	* @param deltaTime		Time since last update (In seconds)
 	*/
-	void MainUpdate(const float& deltaTime);
+	virtual void MainUpdate(const float& deltaTime);
 
 	/**
 	* Callback for when an object gets destroyed
@@ -96,6 +100,12 @@ public:
 	*/
 	void OnNetObjectDestroy(const OObject* object);
 
+	/**
+	* Callback for when a level is about to be destroyed (Any actors still alive will be deleted without being destroyed)
+	* @param level			The level being destroyed
+	*/
+	void OnNetLevelDestroy(const LLevel* level);
+
 protected:
 	/**
 	* Callback for before a net update occurs
@@ -111,6 +121,12 @@ protected:
 	*/
 	void PostNetUpdate();
 
+	/**
+	* Checksum the net synced state of the game, so two simulations can be compared (e.g. A replay against its recording)
+	* @returns Checksum of every net object and the current level's net actors
+	*/
+	uint32 ComputeStateChecksum() const;
+
 
 protected:
 	/**
@@ -152,19 +168,22 @@ protected:
 	*/
 protected:
 	inline uint16 NewPlayerID() { return m_playerIdCounter++; }
-	inline uint16 NewObjectID() { return m_objectNetIdCounter++; }
-	inline uint16 NewActorID() { return m_actorNetIdCounter++; }
+	inline uint16 NewObjectID() { return m_objectIdAllocator.New(); }
+	inline uint16 NewActorID() { return m_actorIdAllocator.New(); }
 
 public:
 	inline Game* GetGame() const { return m_game; }
 	
 	inline const bool& IsHost() const { return bIsHost; }
-	inline const bool& IsRemote() const { return !bIsHost; }
+	inline bool IsRemote() const { return !bIsHost; }
 	inline const bool& IsConnected() const { return bIsConnected; }
 
 	inline void SetSessionName(const string& name) { m_sessionName = name; }
 	inline const string& GetSessionName() const { return m_sessionName; }
 
+	inline uint64 GetBytesSent() const { return m_TcpSocket->GetBytesSent() + m_UdpSocket->GetBytesSent(); }
+	inline uint64 GetBytesReceived() const { return m_TcpSocket->GetBytesReceived() + m_UdpSocket->GetBytesReceived(); }
+
 	inline void SetMaxPlayerCount(const uint16& count) { m_maxPlayerCount = count; }
 	inline const uint16& GetMaxPlayerCount() const { return m_maxPlayerCount; }
 
@@ -1,5 +1,5 @@
 #pragma once
-#include <SFML\Network.hpp>
+#include <SFML/Network.hpp>
 #include <vector>
 
 #include "Common.h"
@@ -69,6 +69,10 @@ protected:
 	bool bIsOpen = false;
 	bool bIsListener = false;
 
+	/// Totals of raw payload bytes which have passed through this socket
+	uint64 m_bytesSent = 0;
+	uint64 m_bytesReceived = 0;
+
 public:
 	NetSocket(SocketType type);
 	virtual ~NetSocket();
@@ -116,6 +120,16 @@ public:
 	*/
 	virtual bool Connect(NetIdentity identity) = 0;
 
+	/**
+	* Open a connection to the given destination, using a desired local identity (Ignored by default)
+	*/
+	virtual bool ConnectAs(NetIdentity target, NetIdentity asIdentity) { return Connect(target); }
+
+	/**
+	* Return the local identity that this socket is using (Same as identity, if listener)
+	*/
+	virtual NetIdentity GetLocalIdentity() { return m_identity; }
+
 	/**
 	* Getters and setters
 	*/
@@ -128,4 +142,7 @@ public:
 
 	inline const bool& IsOpen() const { return bIsOpen; }
 	inline const bool& IsListener() const { return bIsListener; }
+
+	inline const uint64& GetBytesSent() const { return m_bytesSent; }
+	inline const uint64& GetBytesReceived() const { return m_bytesReceived; }
 };
\ No newline at end of file
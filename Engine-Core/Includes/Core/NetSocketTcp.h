@@ -8,7 +8,7 @@ class CORE_API NetSocketTcp : public NetSocket
 private:
 	// Active connections used by this listener
 	std::vector<sf::TcpSocket*> m_activeConnections;
-	sf::Socket* m_socket;
+	sf::Socket* m_socket = nullptr;
 
 public:
 	NetSocketTcp(); 
@@ -52,6 +52,6 @@ public:
 	/**
 	* Return the local identity that this socket is using (Same as identity, if listener)
 	*/
-	NetIdentity GetLocalIdentity();
+	virtual NetIdentity GetLocalIdentity();
 };
 
@@ -6,7 +6,7 @@ class CORE_API NetSocketUdp : public NetSocket
 {
 	friend class NetController;
 private:
-	sf::UdpSocket* m_socket;
+	sf::UdpSocket* m_socket = nullptr;
 
 public:
 	NetSocketUdp();
@@ -50,6 +50,6 @@ public:
 	/**
 	* Open a connection to the given destination, using a desired port
 	*/
-	bool ConnectAs(NetIdentity target, NetIdentity asIdentity);
+	virtual bool ConnectAs(NetIdentity target, NetIdentity asIdentity);
 };
 
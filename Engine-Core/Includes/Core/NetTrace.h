@@ -0,0 +1,173 @@
+#pragma once
+#include "Common.h"
+
+
+/**
+* Should net trace points be compiled in at all
+*/
+#ifndef NET_TRACE_ENABLED
+#define NET_TRACE_ENABLED 1
+#endif
+
+/**
+* How many events are kept, before the oldest are overwritten
+*/
+#ifndef NET_TRACE_CAPACITY
+#define NET_TRACE_CAPACITY 65536
+#endif
+
+/**
+* Where the trace is written when the engine closes
+*/
+#ifndef NET_TRACE_PATH
+#define NET_TRACE_PATH "NetTrace.json"
+#endif
+
+/**
+* Where the trace is written when the net update falls behind (Overwritten by each spike)
+*/
+#ifndef NET_TRACE_SPIKE_PATH
+#define NET_TRACE_SPIKE_PATH "NetTrace_Spike.ntrace"
+#endif
+
+/**
+* Minimum time between spike dumps (In seconds)
+*/
+#ifndef NET_TRACE_SPIKE_COOLDOWN
+#define NET_TRACE_SPIKE_COOLDOWN 10
+#endif
+
+
+#define NET_TRACE_CONCAT_INNER(a, b) a##b
+#define NET_TRACE_CONCAT(a, b) NET_TRACE_CONCAT_INNER(a, b)
+
+#if NET_TRACE_ENABLED
+/// Record a span covering the rest of this scope
+#define NET_TRACE_SCOPE(name) NetTraceScope NET_TRACE_CONCAT(_netTraceScope, __LINE__)(name)
+/// Record a span covering the rest of this scope, tagged with a value (e.g. The connection it was for)
+#define NET_TRACE_SCOPE_ARG(name, arg) NetTraceScope NET_TRACE_CONCAT(_netTraceScope, __LINE__)(name, arg)
+/// Record the current value of a counter
+#define NET_TRACE_COUNTER(name, value) do { if (NetTrace::IsEnabled()) NetTrace::RecordCounter(name, value); } while (0)
+#else
+#define NET_TRACE_SCOPE(name) ((void)0)
+#define NET_TRACE_SCOPE_ARG(name, arg) ((void)0)
+#define NET_TRACE_COUNTER(name, value) ((void)0)
+#endif
+
+
+/**
+* Records spans and counters from the net tick into a fixed size ring, so they can be dumped out for offline analysis
+* Recording is only a few stores per event (Names must be string literals, as only the pointer is kept)
+* -NOTE: Main thread only
+*/
+class CORE_API NetTrace
+{
+public:
+	enum class EventType : uint8
+	{
+		Span		= 0,
+		Counter		= 1,
+	};
+
+	struct Event
+	{
+		const char* name;
+		/// Time since tracing was enabled (In microseconds)
+		uint64		timestamp;
+		/// How long the span lasted (In microseconds, always 0 for counters)
+		uint32		duration;
+		/// Span argument or counter value
+		uint32		value;
+		EventType	type;
+	};
+
+private:
+	static bool bIsEnabled;
+
+public:
+	/**
+	* Start recording (Allocates the ring, so clears anything previously recorded)
+	* @param capacity		How many events to keep
+	*/
+	static void Enable(const uint32& capacity = NET_TRACE_CAPACITY);
+
+	/**
+	* Stop recording (Keeps what was recorded, so it can still be dumped)
+	*/
+	static void Disable();
+
+	/**
+	* Get the current trace time
+	* @returns Time since tracing was enabled (In microseconds)
+	*/
+	static uint64 Now();
+
+	/**
+	* Record a finished span
+	* @param name			Name of the span (Must be a string literal)
+	* @param start			When the span started (From Now)
+	* @param arg			Value to tag the span with
+	*/
+	static void RecordSpan(const char* name, const uint64& start, const uint32& arg = 0);
+
+	/**
+	* Record the current value of a counter
+	* @param name			Name of the counter (Must be a string literal)
+	* @param value			The value of the counter
+	*/
+	static void RecordCounter(const char* name, const uint32& value);
+
+	/**
+	* Write all recorded events out as a Chrome trace (Load through chrome://tracing or similar)
+	* @param path			Where to write the file
+	* @returns If the file was written
+	*/
+	static bool DumpChromeJson(const string& path);
+
+	/**
+	* Write all recorded events out in a compact binary form
+	* Format: magic, version, name count, names (Null terminated), event count, events (name index, type, timestamp, duration, value)
+	* @param path			Where to write the file
+	* @returns If the file was written
+	*/
+	static bool DumpBinary(const string& path);
+
+
+	/**
+	* Getters & Setters
+	*/
+public:
+	static inline bool IsEnabled() { return bIsEnabled; }
+
+	/**
+	* @returns How many events are currently held
+	*/
+	static uint32 GetEventCount();
+};
+
+
+/**
+* Records a span from construction to destruction (If tracing is enabled)
+*/
+class CORE_API NetTraceScope
+{
+private:
+	const char* m_name;
+	uint64 m_start;
+	uint32 m_arg;
+	bool bIsRecording;
+
+public:
+	inline NetTraceScope(const char* name, const uint32& arg = 0) :
+		m_name(name), m_start(0), m_arg(arg), bIsRecording(NetTrace::IsEnabled())
+	{
+		if (bIsRecording)
+			m_start = NetTrace::Now();
+	}
+
+	inline ~NetTraceScope()
+	{
+		if (bIsRecording)
+			NetTrace::RecordSpan(m_name, m_start, m_arg);
+	}
+};
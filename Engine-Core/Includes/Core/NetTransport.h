@@ -0,0 +1,37 @@
+#pragma once
+#include "Common.h"
+#include "NetSocket.h"
+
+
+/**
+* Builds the sockets which sessions talk through, so what actually carries the packets can be swapped out
+* (e.g. For an in-memory transport, when testing without a network)
+*/
+class CORE_API NetTransport
+{
+public:
+	virtual ~NetTransport() {}
+
+	/**
+	* Build a new socket over this transport
+	* @param type			The type of socket to build
+	* @returns The new socket (Memory managed by the caller and must be deleted before this transport)
+	*/
+	virtual NetSocket* BuildSocket(const SocketType& type) = 0;
+
+	/**
+	* Get the transport which uses real sockets (Used by sessions, unless told otherwise)
+	* @returns The shared default transport
+	*/
+	static NetTransport* GetDefault();
+};
+
+
+/**
+* Transport over real TCP/UDP sockets
+*/
+class CORE_API NetSystemTransport : public NetTransport
+{
+public:
+	virtual NetSocket* BuildSocket(const SocketType& type) override;
+};
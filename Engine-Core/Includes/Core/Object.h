@@ -13,7 +13,7 @@ class Game;
 */
 class CORE_API OObject : public ManagedObject, public NetSerializableBase
 {
-	CLASS_BODY()
+	CLASS_BODY(ManagedObject)
 private:
 	Game* m_game = nullptr;
 	string m_name;
@@ -7,8 +7,8 @@
 */
 class CORE_API OPlayerController : public OObject
 {
-	CLASS_BODY()
-	friend NetSession;
+	CLASS_BODY(OObject)
+	friend class NetSession;
 private:
 	string m_playerName;
 
@@ -0,0 +1,153 @@
+#pragma once
+#include "Common.h"
+#include "SpriteBatch.h"
+
+#ifdef BUILD_CLIENT
+#include <vector>
+#include <memory>
+#include <SFML/Graphics.hpp>
+
+
+/**
+* A single textured quad to be drawn
+*/
+struct RenderItem
+{
+	vec2				location;
+	vec2				size;
+	TextureRegion		texture;
+	Colour				colour;
+};
+
+/**
+* A prebuilt vertex array to be drawn in a single call
+* The vertices are shared with the owner, so the owner must copy them before making changes, if they're still referenced (Copy-on-write)
+*/
+struct RenderMesh
+{
+	vec2									location;
+	std::shared_ptr<const sf::VertexArray>	vertices;
+	const sf::Texture*						texture;
+};
+
+
+/**
+* Everything to be drawn on a single layer
+*/
+struct RenderLayer
+{
+	std::vector<RenderItem> items;
+	std::vector<RenderMesh> meshes;
+};
+
+
+/**
+* Everything that should be drawn for a single logic tick
+* Built on the main thread and then handed to the display thread, so drawing never touches live actors
+*/
+class CORE_API RenderSnapshot
+{
+private:
+	/// Items bucketed by layer as they're added, so no sort is needed before drawing
+	std::vector<RenderLayer> m_layers;
+	vec2 m_viewCentre;
+	bool bHasView = false;
+
+public:
+	/**
+	* Queue a quad to be drawn
+	* @param layer			The drawing layer (Lower layers are drawn first)
+	* @param location		The top left corner of the quad
+	* @param size			The size of the quad
+	* @param texture		The texture (Or atlas region) to fill the quad with (nullptr for a solid colour)
+	* @param colour			The colour to multiply the texture by
+	*/
+	inline void AddQuad(const uint8& layer, const vec2& location, const vec2& size, const TextureRegion& texture, const Colour& colour = Colour::White)
+	{
+		GetLayer(layer).items.push_back({ location, size, texture, colour });
+	}
+
+	/**
+	* Queue a mesh to be drawn
+	* @param layer			The drawing layer (Lower layers are drawn first)
+	* @param location		Offset to apply to all vertices
+	* @param vertices		The vertices to draw (Must not be modified whilst any snapshot holds them)
+	* @param texture		The texture used by the vertices
+	*/
+	inline void AddMesh(const uint8& layer, const vec2& location, const std::shared_ptr<const sf::VertexArray>& vertices, const sf::Texture* texture)
+	{
+		GetLayer(layer).meshes.push_back({ location, vertices, texture });
+	}
+
+	/**
+	* Set where the view should be centred for this snapshot
+	* @param centre			The world location at the centre of the view
+	*/
+	inline void SetView(const vec2& centre) { m_viewCentre = centre; bHasView = true; }
+
+	/** Remove everything from this snapshot (Keeps memory for reuse) */
+	void Clear();
+
+	/**
+	* Draw this snapshot, in layer order (Meshes are drawn before items on the same layer)
+	* @param window			The window to draw to
+	* @param batch			The batch to submit quads through
+	*/
+	void Draw(sf::RenderWindow* window, SpriteBatch& batch) const;
+
+private:
+	static void DrawMesh(sf::RenderWindow* window, const RenderMesh& mesh);
+
+	/** Fetch the bucket for this layer, creating it if needed */
+	inline RenderLayer& GetLayer(const uint8& layer)
+	{
+		if (layer >= m_layers.size())
+			m_layers.resize(layer + 1);
+		return m_layers[layer];
+	}
+
+
+	/**
+	* Getters & Setters
+	*/
+public:
+	inline const std::vector<RenderLayer>& GetLayers() const { return m_layers; }
+};
+
+
+/**
+* Hands snapshots from the main thread to the display thread
+* The main thread writes into one snapshot, whilst the display thread draws another, and only the pointer swap is locked
+*/
+class CORE_API RenderSnapshotBuffer
+{
+private:
+	RenderSnapshot m_snapshots[3];
+	RenderSnapshot* m_writeSnapshot;
+	RenderSnapshot* m_readySnapshot;
+	RenderSnapshot* m_drawSnapshot;
+	bool bHasNewSnapshot = false;
+
+	sf::Mutex m_swapMutex;
+
+public:
+	RenderSnapshotBuffer();
+
+	/**
+	* Get the snapshot to fill for this tick (Main thread only)
+	* @returns The empty snapshot
+	*/
+	RenderSnapshot& BeginWrite();
+
+	/**
+	* Make the written snapshot available to the display thread (Main thread only)
+	*/
+	void Publish();
+
+	/**
+	* Get the most recently published snapshot (Display thread only)
+	* @returns The snapshot to draw, which stays valid until the next call
+	*/
+	const RenderSnapshot& AcquireLatest();
+};
+#endif
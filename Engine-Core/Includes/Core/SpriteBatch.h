@@ -0,0 +1,61 @@
+#pragma once
+#include "Common.h"
+#include "TextureAtlas.h"
+
+#ifdef BUILD_CLIENT
+#include <vector>
+#include <SFML/Graphics.hpp>
+
+
+/**
+* Collects textured quads and submits them in as few draw calls as possible
+* Consecutive quads which share a texture are merged into a single vertex list
+*/
+class CORE_API SpriteBatch
+{
+private:
+	sf::RenderTarget* m_target = nullptr;
+	const sf::Texture* m_texture = nullptr;
+	std::vector<sf::Vertex> m_vertices;
+
+	uint32 m_drawCallCount = 0;
+	uint32 m_quadCount = 0;
+
+public:
+	/**
+	* Start a new batch (Resets draw stats)
+	* @param target			Where quads should be drawn to
+	*/
+	void Begin(sf::RenderTarget* target);
+
+	/**
+	* Queue a quad, which will only be drawn once the texture changes or the batch is flushed
+	* @param location		The top left corner of the quad
+	* @param size			The size of the quad
+	* @param texture		The texture region to fill the quad with (Invalid for a solid colour)
+	* @param colour			The colour to multiply the texture by
+	*/
+	void AddQuad(const vec2& location, const vec2& size, const TextureRegion& texture, const Colour& colour);
+
+	/**
+	* Draw any queued quads now
+	* (Must be called before drawing anything to the target outside of the batch, to keep draw order)
+	*/
+	void Flush();
+
+	/**
+	* Finish the current batch, drawing anything still queued
+	*/
+	inline void End() { Flush(); m_target = nullptr; }
+
+
+	/**
+	* Getters & Setters
+	*/
+public:
+	/** Number of draw calls made since Begin */
+	inline const uint32& GetDrawCallCount() const { return m_drawCallCount; }
+	/** Number of quads submitted since Begin */
+	inline const uint32& GetQuadCount() const { return m_quadCount; }
+};
+#endif
@@ -0,0 +1,87 @@
+#pragma once
+#include "Common.h"
+
+#include <vector>
+#include <SFML/Graphics.hpp>
+
+
+/**
+* Size (In pixels) of each atlas page (Will be clamped to the largest texture the GPU supports)
+*/
+#ifndef TEXTURE_ATLAS_SIZE
+#define TEXTURE_ATLAS_SIZE 1024
+#endif
+
+
+/**
+* Handle to an area of a texture
+* Textures packed into an atlas share the same texture, so can be drawn together
+*/
+struct CORE_API TextureRegion
+{
+	const sf::Texture*	texture = nullptr;
+	sf::IntRect			rect;
+
+	TextureRegion() {}
+	/** Region covering the entire texture */
+	TextureRegion(const sf::Texture* texture);
+	TextureRegion(const sf::Texture* texture, const sf::IntRect& rect) : texture(texture), rect(rect) {}
+
+	inline bool IsValid() const { return texture != nullptr; }
+};
+
+
+#ifdef BUILD_CLIENT
+/**
+* Packs many small images into a few large textures
+* Images are placed left to right along shelves, starting a new shelf (Or page) when the current one is full
+*/
+class CORE_API TextureAtlas
+{
+private:
+	struct Page
+	{
+		sf::Texture*	texture;
+		uint32			shelfX;
+		uint32			shelfY;
+		uint32			shelfHeight;
+	};
+
+	std::vector<Page> m_pages;
+	uint32 m_pageSize;
+	uint32 m_padding;
+
+public:
+	/**
+	* @param pageSize		Width and height of each page (In pixels)
+	* @param padding		Empty pixels to leave between images
+	*/
+	TextureAtlas(const uint32& pageSize = TEXTURE_ATLAS_SIZE, const uint32& padding = 1);
+	~TextureAtlas();
+
+	TextureAtlas(const TextureAtlas&) = delete;
+	TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+	/**
+	* Copy this image into the atlas
+	* @param image			The image to add
+	* @returns Where the image has been placed or an invalid region, if it is too large to fit on a page
+	*/
+	TextureRegion Pack(const sf::Image& image);
+
+private:
+	/**
+	* Create a new empty page
+	* @returns The new page
+	*/
+	Page& AddPage();
+
+
+	/**
+	* Getters & Setters
+	*/
+public:
+	inline uint32 GetPageCount() const { return m_pages.size(); }
+	inline const uint32& GetPageSize() const { return m_pageSize; }
+};
+#endif
@@ -4,12 +4,14 @@
 */
 
 #include <string>
-#include <SFML\Graphics\Color.hpp>
-#include <SFML\System\Vector2.hpp>
-#include <SFML\System\Vector3.hpp>
+#include <cstdint>
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <SFML/System/Vector3.hpp>
 
 typedef std::string	string;
 
+#if defined(_MSC_VER)
 typedef __int8 int8;
 typedef __int16 int16;
 typedef __int32 int32;
@@ -19,6 +21,17 @@ typedef unsigned __int8 uint8;
 typedef unsigned __int16 uint16;
 typedef unsigned __int32 uint32;
 typedef unsigned __int64 uint64;
+#else
+typedef std::int8_t int8;
+typedef std::int16_t int16;
+typedef std::int32_t int32;
+typedef std::int64_t int64;
+
+typedef std::uint8_t uint8;
+typedef std::uint16_t uint16;
+typedef std::uint32_t uint32;
+typedef std::uint64_t uint64;
+#endif
 
 
 typedef sf::Vector2<float>	vec2;
@@ -26,4 +39,4 @@ typedef sf::Vector2<int32>	ivec2;
 typedef sf::Vector2<uint32>	uvec2;
 
 
-typedef sf::Color Colour;
\ No newline at end of file
+typedef sf::Color Colour;
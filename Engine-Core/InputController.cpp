@@ -1,5 +1,5 @@
-#include "Includes\Core\InputController.h"
-#include "Includes\Core\Game.h"
+#include "Includes/Core/InputController.h"
+#include "Includes/Core/Game.h"
 
 
 InputController::InputController()
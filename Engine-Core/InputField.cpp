@@ -1,5 +1,6 @@
-#include "Includes\Core\InputField.h"
-#include "Includes\Core\Game.h"
+#include "Includes/Core/InputField.h"
+#include "Includes/Core/Game.h"
+#include <cmath>
 
 
 CLASS_SOURCE(UInputField, CORE_API)
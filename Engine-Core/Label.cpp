@@ -1,4 +1,4 @@
-#include "Includes\Core\Label.h"
+#include "Includes/Core/Label.h"
 
 
 CLASS_SOURCE(ULabel, CORE_API)
@@ -1,6 +1,6 @@
-#include "Includes\Core\Level.h"
-#include "Includes\Core\Game.h"
-#include "Includes\Core\NetSession.h"
+#include "Includes/Core/Level.h"
+#include "Includes/Core/Game.h"
+#include "Includes/Core/NetSession.h"
 
 
 CLASS_SOURCE(LLevel, CORE_API)
@@ -10,8 +10,6 @@ uint16 LLevel::s_instanceCounter = 0;
 LLevel::LLevel() :
 	m_instanceId(s_instanceCounter++)
 {
-	// Work around: TODO - Proper memory management to stop ptr errors
-	m_drawnActors.reserve(200); 
 }
 
 LLevel::~LLevel()
@@ -43,64 +41,53 @@ void LLevel::MainUpdate(const float& deltaTime)
 	}
 
 
-	// Perform cleanup
+	// Perform cleanup (Compacted in a single pass, so mass destruction stays linear and order is kept)
+	// Actors to delete are swapped to the end, so they can be removed from the index before being deleted
+	uint32 keptCount = 0;
 	for (uint32 i = 0; i < m_activeActors.size(); ++i)
 	{
 		AActor* actor = m_activeActors[i];
 		// Attempt to destroy object, if only remaining reference is this
 		if (!actor->IsDestroyed() || actor->GetRemainingSystemReferences() != 1)
-			continue;
+			std::swap(m_activeActors[keptCount++], m_activeActors[i]);
+		else
+			m_actorIndex.MarkDirty(actor->GetClass());
+	}
+	m_actorIndex.RemoveDestroyed();
 
-		// Remove object
-		m_activeActors.erase(m_activeActors.begin() + i);
-		--i;
+	for (uint32 i = keptCount; i < m_activeActors.size(); ++i)
+	{
+		AActor* actor = m_activeActors[i];
 
 		// Remove networking reference
 		if (actor->GetNetworkID() != 0)
-			m_netActorLookup.erase(actor->GetNetworkID());
+			m_netActorLookup.Remove(actor->GetNetworkID(), actor);
+
+		auto instanceIt = m_instanceActorLookup.find(actor->GetInstanceID());
+		if (instanceIt != m_instanceActorLookup.end() && instanceIt->second == actor)
+			m_instanceActorLookup.erase(instanceIt);
 
-		delete actor;
+		MClass::DeletePooled(actor);
 	}
+	m_activeActors.resize(keptCount);
 }
 
 #ifdef BUILD_CLIENT
-void LLevel::DisplayUpdate(sf::RenderWindow* window, const float& deltaTime)
+void LLevel::Render(RenderSnapshot& snapshot)
 {
-	// Draw all actors by layer
-	for (uint32 layer = 0; layer <= 10; ++layer)
-	{
-		for (uint32 i = 0; i < m_drawnActors.size(); ++i)
-		{
-			if (bIsDestroying)
-				return;
-
-			AActor* actor = m_drawnActors[i]; // TODO - Better safety with memory destruction
-			actor->bIsBeingDrawn = true;
-
-			// Remove references
-			if (actor->IsDestroyed())
-			{
-				actor->RemoveSystemReference();
-				m_drawnActors.erase(m_drawnActors.begin() + i);
-				--i;
-				actor->bIsBeingDrawn = false;
-				continue;
-			}
-
-
-			if (actor->GetDrawingLayer() == layer && actor->IsVisible())
-				actor->OnDraw(window, deltaTime);
-			actor->bIsBeingDrawn = false;
-		}
-	}
+	if (bIsDestroying)
+		return;
 
+	for (AActor* actor : m_activeActors)
+		if (actor->IsVisible() && !actor->IsDestroyed())
+			actor->OnRender(snapshot);
+}
+
+void LLevel::DisplayUpdate(sf::RenderWindow* window, const float& deltaTime)
+{
 	// Draw hud
-	if (m_hud != nullptr)
-	{
-		m_hud->bIsBeingDrawn = true;
+	if (m_hud != nullptr && !bIsDestroying)
 		m_hud->DisplayUpdate(window, deltaTime);
-		m_hud->bIsBeingDrawn = false;
-	}
 }
 #endif
 
@@ -137,21 +124,38 @@ void LLevel::Destroy()
 	bIsDestroying = true;
 	OnDestroyLevel();
 
-	m_drawnActors.clear();
+	NetSession* session = GetGame()->GetSession();
+	if (session != nullptr)
+		session->OnNetLevelDestroy(this);
 
 	for (AActor* actor : m_activeActors)
-	{
 		actor->OnDestroy();
 
-#ifdef BUILD_CLIENT
-		// Wait until actor is finished being drawn
-		while (actor->bIsBeingDrawn) 
-			sf::sleep(sf::milliseconds(2));
-#endif
+	// Level can no longer be queried, deletion happens through HandleDestroy
+	m_actorIndex.Clear();
+	m_netActorLookup.Clear();
+	m_instanceActorLookup.clear();
+}
+
+bool LLevel::HandleDestroy(const uint32& maxCount)
+{
+	uint32 keptCount = 0;
+	uint32 deletedCount = 0;
+	for (uint32 i = 0; i < m_activeActors.size(); ++i)
+	{
+		AActor* actor = m_activeActors[i];
 
-		delete actor;
+		if (deletedCount >= maxCount)
+		{
+			m_activeActors[keptCount++] = actor;
+			continue;
+		}
+
+		MClass::DeletePooled(actor);
+		++deletedCount;
 	}
-	m_activeActors.clear();
+	m_activeActors.resize(keptCount);
+	return m_activeActors.empty();
 }
 
 void LLevel::AddActor(AActor* actor)
@@ -165,19 +169,15 @@ void LLevel::AddActor(AActor* actor)
 	// Add to level
 	actor->AddSystemReference();
 	m_activeActors.emplace_back(actor);
-
-#ifdef BUILD_CLIENT
-	// Add to rendering
-	actor->AddSystemReference();
-	m_drawnActors.emplace_back(actor);
-#endif
+	m_actorIndex.Add(actor);
+	m_instanceActorLookup.emplace(actor->GetInstanceID(), actor); // Keep first actor, if ids are reused
 
 	// Add to look up table, if net synced
 	NetSession* session = GetGame()->GetSession();
 	if (session != nullptr)
 	{
 		if (actor->GetNetworkID() != 0)
-			m_netActorLookup[actor->GetNetworkID()] = actor;
+			m_netActorLookup.Set(actor->GetNetworkID(), actor);
 		actor->UpdateRole(session);
 	}
 	else
@@ -190,7 +190,7 @@ void LLevel::AddActor(AActor* actor)
 template<>
 AActor* LLevel::SpawnActor(const SubClassOf<AActor>& actorClass, const OObject* owner)
 {
-	AActor* actor = actorClass->New<AActor>();
+	AActor* actor = actorClass->NewPooled<AActor>();
 	if (actor == nullptr)
 		return nullptr;
 	actor->bWasSpawnedWithLevel = bIsBuilding;
@@ -200,20 +200,23 @@ AActor* LLevel::SpawnActor(const SubClassOf<AActor>& actorClass, const OObject*
 	return actor;
 }
 
-AActor* LLevel::GetActorByInstance(const uint32& id) const 
+void LLevel::ReserveActors(const uint32& count)
 {
-	// For each not guaranteed to be safe
-	for (uint32 i = 0; i < m_activeActors.size(); ++i)
-		if (m_activeActors[i]->GetInstanceID() == id)
-			return m_activeActors[i];
-	return nullptr;
-
+	const uint32 total = m_activeActors.size() + count;
+	m_activeActors.reserve(total);
+	// Net lookup is indexed by id rather than count (And ids may be recycled), so it grows as the ids arrive
+	m_instanceActorLookup.reserve(total);
 }
 
-AActor* LLevel::GetActorByNetID(const uint32& id) const 
+AActor* LLevel::GetActorByInstance(const uint32& id) const 
 {
-	auto it = m_netActorLookup.find(id);
-	if (it == m_netActorLookup.end())
+	auto it = m_instanceActorLookup.find(id);
+	if (it == m_instanceActorLookup.end())
 		return nullptr;
 	return it->second;
+}
+
+AActor* LLevel::GetActorByNetID(const uint32& id) const 
+{
+	return m_netActorLookup.Find(id);
 }
\ No newline at end of file
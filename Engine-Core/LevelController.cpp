@@ -1,4 +1,4 @@
-#include "Includes\Core\LevelController.h"
+#include "Includes/Core/LevelController.h"
 
 
 CLASS_SOURCE(ALevelController, CORE_API)
@@ -1,59 +1,289 @@
-#include "Includes\Core\Logger.h"
+#include "Includes/Core/Logger.h"
 #include <ctime>
-#include <sstream>
-#include <iostream>
+#include <cstdarg>
+#include <atomic>
+#include <thread>
+#include <chrono>
 
 
+static_assert((LOG_QUEUE_SIZE & (LOG_QUEUE_SIZE - 1)) == 0, "LOG_QUEUE_SIZE must be a power of 2");
+
+
+/**
+* A single preformatted message waiting to be written
+*/
+struct LogRecord
+{
+	/// Which lap of the queue this record is on (Lets producers and the writer tell whether it is free or ready)
+	std::atomic<unsigned int> sequence;
+
+	Logger::Level level;
+	time_t time;
+	const char* file;
+	int line;
+	unsigned int length;
+	char text[MAX_LOG_MSG];
+};
+
+static LogRecord s_records[LOG_QUEUE_SIZE];
+static std::atomic<unsigned int> s_writeIndex(0);
+static unsigned int s_readIndex = 0; // Only touched by writer
+
+static std::atomic<bool> bIsRunning(false);
+static std::thread* s_writerThread = nullptr;
+/// Producers currently between checking bIsRunning and publishing their record (Shutdown waits on these)
+static std::atomic<unsigned int> s_activeProducers(0);
+
+
+/**
+* Get the time in format [%H:%M:%S] (Only reformatted when the second changes)
+* (Cached per thread, as immediate writes may format alongside the writer thread)
+* @param time			The time to format
+* @returns The cached timestamp
+*/
+static const char* TimeStamp(const time_t& time)
+{
+	static thread_local time_t cachedTime = -1;
+	static thread_local char cachedStamp[16];
+
+	if (time != cachedTime)
+	{
+		tm date;
+#ifdef _WIN32
+		gmtime_s(&date, &time);
+#else
+		gmtime_r(&time, &date);
+#endif
+		//[%d-%m-%Y %H:%M:%S]
+		strftime(cachedStamp, sizeof(cachedStamp), "[%H:%M:%S]", &date);
+		cachedTime = time;
+	}
+	return cachedStamp;
+}
+
+/**
+* Append a record onto the output for its level
+*/
+static void FormatRecord(const LogRecord& record, std::string& out, std::string& err)
+{
+	std::string& target = record.level == Logger::Level::Error ? err : out;
+
+	if (record.level == Logger::Level::Warning)
+		target += "__WARNING__";
+	else if (record.level == Logger::Level::Error)
+		target += "___ERROR___";
+
+	target += TimeStamp(record.time);
+	target += ": ";
+	target.append(record.text, record.length);
+	target += '\n';
+
+	if (record.file != nullptr)
+	{
+		target += "\t@ (";
+		target += std::to_string(record.line);
+		target += ')';
+		target += record.file;
+		target += '\n';
+	}
+}
+
+static void WriteOutput(std::string& out, std::string& err)
+{
+	if (out.size() != 0)
+	{
+		fwrite(out.data(), 1, out.size(), stdout);
+		fflush(stdout);
+		out.clear();
+	}
+	if (err.size() != 0)
+	{
+		fwrite(err.data(), 1, err.size(), stderr);
+		fflush(stderr);
+		err.clear();
+	}
+}
+
 /**
-* Get the current system time in format [%H:%M:%S]
+* Write out every record that is ready, in a single batch
+* @returns The number of records written
 */
-static std::string TimeStamp()
+static unsigned int DrainQueue()
 {
-	time_t timeStamp = time(nullptr);
-	tm date;
+	static std::string out;
+	static std::string err;
+
+	unsigned int count = 0;
+	while (true)
+	{
+		LogRecord& record = s_records[s_readIndex & (LOG_QUEUE_SIZE - 1)];
+		if (record.sequence.load(std::memory_order_acquire) != s_readIndex + 1)
+			break;
+
+		FormatRecord(record, out, err);
+
+		// Hand the slot back for the next lap
+		record.sequence.store(s_readIndex + LOG_QUEUE_SIZE, std::memory_order_release);
+		++s_readIndex;
+		++count;
+	}
+
+	WriteOutput(out, err);
+	return count;
+}
+
+static void WriterLoop()
+{
+	while (bIsRunning.load(std::memory_order_acquire))
+	{
+		if (DrainQueue() == 0)
+			std::this_thread::sleep_for(std::chrono::milliseconds(LOG_FLUSH_INTERVAL));
+	}
+	DrainQueue();
+}
+
+
+void Logger::Start()
+{
+	if (s_writerThread != nullptr)
+		return;
+
+	for (unsigned int i = 0; i < LOG_QUEUE_SIZE; ++i)
+		s_records[i].sequence.store(i, std::memory_order_relaxed);
+	s_writeIndex.store(0, std::memory_order_relaxed);
+	s_readIndex = 0;
+
+	bIsRunning.store(true, std::memory_order_release);
+	s_writerThread = new std::thread(&WriterLoop);
+}
+
+void Logger::Shutdown()
+{
+	if (s_writerThread == nullptr)
+		return;
+
+	bIsRunning.store(false);
+	s_writerThread->join();
+	delete s_writerThread;
+	s_writerThread = nullptr;
+
+	// Wait for anything that was mid-push as the writer stopped, then catch it
+	// (Producers arriving from now on see the writer has stopped, so write immediately)
+	while (s_activeProducers.load() != 0)
+		std::this_thread::yield();
+	DrainQueue();
+}
+
+/**
+* Format and write a message immediately, on the calling thread
+*/
+static void WriteImmediate(const Logger::Level& level, const char* file, const int& line, const char* format, va_list args)
+{
+	LogRecord record;
+	record.level = level;
+	record.time = time(nullptr);
+	record.file = file;
+	record.line = line;
+	const int length = vsnprintf(record.text, sizeof(record.text), format, args);
+	record.length = length < 0 ? 0 : (length < MAX_LOG_MSG ? length : MAX_LOG_MSG - 1);
+
+	std::string out;
+	std::string err;
+	FormatRecord(record, out, err);
+	WriteOutput(out, err);
+}
+
+/**
+* Claim a free record in the queue (Multiple producers may call this at once)
+* If the queue is full, this waits for the writer to free a record, rather than losing the message
+* @returns The record to fill or nullptr, if the queue is full and the writer has stopped
+*/
+static LogRecord* ClaimRecord(unsigned int& outIndex)
+{
+	unsigned int index = s_writeIndex.load(std::memory_order_relaxed);
+	while (true)
+	{
+		LogRecord& record = s_records[index & (LOG_QUEUE_SIZE - 1)];
+		const int diff = (int)(record.sequence.load(std::memory_order_acquire) - index);
+
+		if (diff == 0)
+		{
+			if (s_writeIndex.compare_exchange_weak(index, index + 1, std::memory_order_relaxed))
+			{
+				outIndex = index;
+				return &record;
+			}
+		}
+		// Writer hasn't freed this slot yet
+		else if (diff < 0)
+		{
+			// Nothing is going to free it
+			if (!bIsRunning.load(std::memory_order_acquire))
+				return nullptr;
+
+			std::this_thread::yield();
+			index = s_writeIndex.load(std::memory_order_relaxed);
+		}
+		else
+			index = s_writeIndex.load(std::memory_order_relaxed);
+	}
+}
+
+void Logger::Log(const Level& level, const char* file, const int& line, const char* format, ...)
+{
+	va_list args;
+	va_start(args, format);
+
+	// Write immediately, if the writer isn't running
+	// (Registered as active first, so Shutdown either sees this producer or this producer sees Shutdown)
+	s_activeProducers.fetch_add(1);
+	unsigned int index;
+	LogRecord* record = bIsRunning.load() ? ClaimRecord(index) : nullptr;
+	if (record == nullptr)
+	{
+		s_activeProducers.fetch_sub(1);
+		WriteImmediate(level, file, line, format, args);
+		va_end(args);
+		return;
+	}
 
-	gmtime_s(&date, &timeStamp);
+	record->level = level;
+	record->time = time(nullptr);
+	record->file = file;
+	record->line = line;
+	const int length = vsnprintf(record->text, sizeof(record->text), format, args);
+	record->length = length < 0 ? 0 : (length < MAX_LOG_MSG ? length : MAX_LOG_MSG - 1);
+	va_end(args);
 
-	char timec[16];
-	//[%d-%m-%Y %H:%M:%S]
-	strftime(timec, 80, "[%H:%M:%S]", &date);
-	return timec;
+	// Publish to writer
+	record->sequence.store(index + 1, std::memory_order_release);
+	s_activeProducers.fetch_sub(1, std::memory_order_release);
 }
 
-void Logger::LogMessage(std::string msg)
+void Logger::LogMessage(const std::string& msg)
 {
-	std::stringstream stream;
-	stream << TimeStamp() << ": " << msg << '\n';
-	std::cout << stream.str();
+	Log(Level::Message, nullptr, 0, "%s", msg.c_str());
 }
 
 #ifdef BUILD_DEBUG
-void Logger::LogWarning(std::string msg, std::string file, int line)
+void Logger::LogWarning(const std::string& msg, const char* file, int line)
 {
-	std::stringstream stream;
-	stream << "__WARNING__" << TimeStamp() << ": " << msg << '\n' << "\t@ (" << line << ')' << file << '\n';
-	std::cout << stream.str();
+	Log(Level::Warning, file, line, "%s", msg.c_str());
 }
 
-void Logger::LogError(std::string msg, std::string file, int line)
+void Logger::LogError(const std::string& msg, const char* file, int line)
 {
-	std::stringstream stream;
-	stream << "___ERROR___" << TimeStamp() << ": " << msg << '\n' << "\t@ (" << line << ')' << file << '\n';
-	std::cerr << stream.str();
+	Log(Level::Error, file, line, "%s", msg.c_str());
 }
 
 #else
-void Logger::LogWarning(std::string msg)
+void Logger::LogWarning(const std::string& msg)
 {
-	std::stringstream stream;
-	stream << "__WARNING__" << TimeStamp() << ": " << msg << '\n';
-	std::cout << stream.str();
+	Log(Level::Warning, nullptr, 0, "%s", msg.c_str());
 }
 
-void Logger::LogError(std::string msg)
+void Logger::LogError(const std::string& msg)
 {
-	std::stringstream stream;
-	stream << "___ERROR___" << TimeStamp() << ": " << msg << '\n';
-	std::cerr << stream.str();
+	Log(Level::Error, nullptr, 0, "%s", msg.c_str());
 }
-#endif
\ No newline at end of file
+#endif
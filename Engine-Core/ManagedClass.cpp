@@ -1,13 +1,56 @@
-#include "Includes\Core\ManagedClass.h"
+#include "Includes/Core/ManagedClass.h"
+#include <unordered_map>
+#include <cstdlib>
 
 
-static uint16 g_classIdCounter = 0;
+/**
+* Lookup of every constructed class by id
+*/
+static std::unordered_map<uint16, const MClass*>& GetClassLookup()
+{
+	static std::unordered_map<uint16, const MClass*> lookup;
+	return lookup;
+}
+
+/**
+* Generate the id for a class from its name
+* (Ids can't rely on construction order, as client and server builds don't construct the same classes)
+* @param name			The name of the class
+* @returns A free id for this class
+*/
+static uint16 NewClassID(const char* name)
+{
+	// FNV-1a, folded down into 16 bits
+	uint32 hash = 2166136261U;
+	for (const char* c = name; *c != '\0'; ++c)
+	{
+		hash ^= (uint8)*c;
+		hash *= 16777619U;
+	}
+	uint16 id = (uint16)((hash >> 16) ^ (hash & 0xFFFF));
+
+	// Probing for a free id would make ids depend on construction order again, so the class must be renamed
+	const auto& lookup = GetClassLookup();
+	auto it = lookup.find(id);
+	if (it != lookup.end())
+	{
+		LOG_ERROR("Class id collision for '%s' with '%s' (One of the classes must be renamed)", name, it->second->GetName().c_str());
+		std::abort();
+	}
+	return id;
+}
 
 
 MClass::MClass(const char* name) :
-	m_name(name), m_id(g_classIdCounter++)
+	m_name(name), m_id(NewClassID(name))
 {
+	GetClassLookup()[m_id] = this;
+}
 
+MClass::~MClass()
+{
+	for (void* memory : m_instancePool)
+		::operator delete(memory);
 }
 
 ManagedObject* MClass::NewObject(void* dst) const 
@@ -20,11 +63,42 @@ const MClass* MClass::GetParentClass() const
 	return nullptr;
 }
 
+uint32 MClass::GetInstanceSize() const
+{
+	return 0;
+}
+
+void* MClass::AllocateInstance() const
+{
+	if (!m_instancePool.empty())
+	{
+		void* memory = m_instancePool.back();
+		m_instancePool.pop_back();
+		return memory;
+	}
+
+	// Allocate in the same way as new would, so pooled objects may still be deleted normally
+	const uint32 size = GetInstanceSize();
+	return size == 0 ? nullptr : ::operator new(size);
+}
+
+void MClass::ReleaseInstance(void* memory) const
+{
+	if (m_instancePool.size() < CLASS_POOL_SIZE)
+		m_instancePool.emplace_back(memory);
+	else
+		::operator delete(memory);
+}
+
 bool MClass::IsChildOf(const MClass* other, const bool& trueIfIdentical) const
 {
 	if (this == other)
 		return trueIfIdentical;
 
+	// Subclasses are numbered directly after their parent, so only need to check against the parent's range
+	if (m_hierarchyIndex != 0 && other != nullptr && other->m_hierarchyIndex != 0)
+		return other->m_hierarchyIndex < m_hierarchyIndex && m_hierarchyIndex <= other->m_hierarchyLast;
+
 	const MClass* parent = GetParentClass();
 	if (parent == nullptr)
 		return false;
@@ -32,6 +106,62 @@ bool MClass::IsChildOf(const MClass* other, const bool& trueIfIdentical) const
 		return parent->IsChildOf(other, true);
 }
 
+void MClass::BuildHierarchy()
+{
+	// Looking up parents may construct new classes, so repeat until every class is known
+	std::vector<MClass*> classes;
+	std::unordered_map<const MClass*, std::vector<MClass*>> children;
+	while (classes.size() != GetClassLookup().size())
+	{
+		classes.clear();
+		for (auto& it : GetClassLookup())
+			classes.emplace_back(const_cast<MClass*>(it.second));
+		for (MClass* type : classes)
+			type->GetParentClass();
+	}
+
+	std::vector<MClass*> roots;
+	for (MClass* type : classes)
+	{
+		const MClass* parent = type->GetParentClass();
+		if (parent == nullptr)
+			roots.emplace_back(type);
+		else
+			children[parent].emplace_back(type);
+	}
+
+
+	// Pre-order walk of the class tree
+	struct Visit 
+	{
+		MClass* type;
+		bool bIsLeaving;
+	};
+	std::vector<Visit> stack;
+	for (MClass* root : roots)
+		stack.push_back({ root, false });
+
+	uint32 index = 0;
+	while (!stack.empty())
+	{
+		Visit visit = stack.back();
+		stack.pop_back();
+
+		if (visit.bIsLeaving)
+		{
+			visit.type->m_hierarchyLast = index;
+			continue;
+		}
+
+		visit.type->m_hierarchyIndex = ++index;
+		stack.push_back({ visit.type, true });
+		for (MClass* child : children[visit.type])
+			stack.push_back({ child, false });
+	}
+
+	LOG("Built class hierarchy (%i classes)", (int)classes.size());
+}
+
 const MClass* ManagedObject::StaticClass()
 {
 	return nullptr;
@@ -1,9 +1,11 @@
-#include "Includes\Core\NetController.h"
+#include "Includes/Core/NetController.h"
 
-#include "Includes\Core\Game.h"
+#include "Includes/Core/Game.h"
 
-#include "Includes\Core\NetHostSession.h"
-#include "Includes\Core\NetRemoteSession.h"
+#include "Includes/Core/NetHostSession.h"
+#include "Includes/Core/NetRemoteSession.h"
+#include "Includes/Core/NetReplaySession.h"
+#include "Includes/Core/DefaultNetLayer.h"
 
 
 
@@ -16,7 +18,6 @@ NetController::NetController(const Engine* engine) :
 	m_localIdentity.ip = sf::IpAddress::getLocalAddress();
 	m_localIdentity.port = 20010;
 
-	m_publicIdentity.ip = sf::IpAddress::getPublicAddress();
 	m_publicIdentity.port = 20010;
 }
 
@@ -44,6 +45,16 @@ NetSocketUdp* NetController::BuildUdpSocket()
 	return socket;
 }
 
+const NetIdentity& NetController::GetPublicIdentity()
+{
+	if (!bHasPublicIdentity)
+	{
+		m_publicIdentity.ip = sf::IpAddress::getPublicAddress();
+		bHasPublicIdentity = true;
+	}
+	return m_publicIdentity;
+}
+
 void NetController::HandleUpdate(const float& deltaTime) 
 {
 	if (m_activeSession != nullptr)
@@ -67,7 +78,7 @@ bool NetController::HostSession(const NetIdentity& host, ConfigLayer configLayer
 		return false;
 	}
 
-	NetHostSession* session = new NetHostSession(m_engine->GetGame(), host);
+	NetHostSession* session = new NetHostSession(m_engine->GetGame(), host, m_transport);
 	session->SetupLayer(m_engine->GetGame()->netLayerClass, configLayer);
 
 	if (!session->Start())
@@ -88,7 +99,7 @@ bool NetController::JoinSession(const NetIdentity& remote, ConfigLayer configLay
 		return false;
 	}
 
-	NetRemoteSession* session = new NetRemoteSession(m_engine->GetGame(), remote);
+	NetRemoteSession* session = new NetRemoteSession(m_engine->GetGame(), remote, m_transport);
 	session->SetupLayer(m_engine->GetGame()->netLayerClass, configLayer);
 
 	if (!session->Start())
@@ -97,6 +108,28 @@ bool NetController::JoinSession(const NetIdentity& remote, ConfigLayer configLay
 		return false;
 	}
 
+	m_activeSession = session;
+	return true;
+}
+
+bool NetController::ReplaySession(const string& path)
+{
+	if (m_activeSession != nullptr)
+	{
+		LOG_ERROR("Cannot replay session, as active session already exist on %s:%i", m_activeSession->GetSessionIdentity().ip.toString().c_str(), m_activeSession->GetSessionIdentity().port);
+		return false;
+	}
+
+	// Default layer, as nothing should go upstream whilst replaying
+	NetReplaySession* session = new NetReplaySession(m_engine->GetGame(), path, m_engine->GetVersionNo());
+	session->SetupLayer(DefaultNetLayer::StaticClass(), ConfigLayer());
+
+	if (!session->Start())
+	{
+		delete session;
+		return false;
+	}
+
 	m_activeSession = session;
 	return true;
 }
\ No newline at end of file
@@ -1,17 +1,20 @@
-#include "Includes\Core\NetHostSession.h"
-#include "Includes\Core\Engine.h"
-#include "Includes\Core\Game.h"
-#include "Includes\Core\Level.h"
+#include "Includes/Core/NetHostSession.h"
+#include "Includes/Core/Engine.h"
+#include "Includes/Core/Game.h"
+#include "Includes/Core/Level.h"
 
+#include <ctime>
 
-NetHostSession::NetHostSession(Game* game, const NetIdentity identity) :
-	NetSession(game, identity)
+
+NetHostSession::NetHostSession(Game* game, const NetIdentity identity, NetTransport* transport) :
+	NetSession(game, identity, transport)
 {
 	bIsHost = true;
 }
 
 NetHostSession::~NetHostSession()
 {
+	StopRecording();
 	LOG("NetHostSession destroyed.");
 }
 
@@ -20,12 +23,12 @@ bool NetHostSession::Start()
 	// Setup listeners
 	const NetIdentity& host = GetSessionIdentity();
 
-	if (!m_TcpSocket.Listen(host))
+	if (!m_TcpSocket->Listen(host))
 	{
 		LOG_ERROR("Unable to open net session on (%s:%i). TCP socket not openned (Maybe the port is already in use).", host.ip.toString().c_str(), host.port);
 		return false;
 	}
-	if (!m_UdpSocket.Listen(host))
+	if (!m_UdpSocket->Listen(host))
 	{
 		LOG_ERROR("Unable to open net session on (%s:%i). UDP socket not openned (Maybe the port is already in use).", host.ip.toString().c_str(), host.port);
 		return false;
@@ -36,10 +39,56 @@ bool NetHostSession::Start()
 	return true;
 }
 
+bool NetHostSession::StartRecording(const string& path, const Version& engineVersion)
+{
+	StopRecording();
+
+	NetReplayHeader header;
+	header.engineVersion = engineVersion;
+	header.gameVersion = GetGame()->GetVersionNo();
+	header.seed = (uint32)std::time(nullptr);
+	header.tickRate = GetTickRate();
+	header.maxPlayerCount = GetMaxPlayerCount();
+	header.levelClass = GetGame()->defaultNetLevel->GetID();
+	header.levelInstanceCounter = LLevel::s_instanceCounter;
+	header.sessionName = GetSessionName();
+
+	m_replay = new NetReplayWriter;
+	if (!m_replay->Open(path, header))
+	{
+		delete m_replay;
+		m_replay = nullptr;
+		return false;
+	}
+
+	// Anything random has to be repeatable by the replay
+	srand(header.seed);
+	m_replayNetTicks = 0;
+	return true;
+}
+
+void NetHostSession::StopRecording()
+{
+	if (m_replay == nullptr)
+		return;
+
+	m_replay->Close();
+	delete m_replay;
+	m_replay = nullptr;
+}
+
+void NetHostSession::MainUpdate(const float& deltaTime)
+{
+	if (m_replay != nullptr)
+		m_replay->WriteTick(deltaTime);
+
+	NetSession::MainUpdate(deltaTime);
+}
+
 void NetHostSession::NetUpdate(const float& deltaTime)
 {
 	// Update for any timed out or pending connection 
-	for (auto& it = m_connectionLookup.begin(); it != m_connectionLookup.end();)
+	for (auto it = m_connectionLookup.begin(); it != m_connectionLookup.end();)
 	{
 		// AFK/Idle packet timeout
 		if (it->second->state == NetPlayerConnection::State::Connected)
@@ -48,6 +97,8 @@ void NetHostSession::NetUpdate(const float& deltaTime)
 			{
 				// Remove controller
 				LOG("%s:%i timed out..", it->second->identity.ip.toString().c_str(), it->second->identity.port);
+				if (m_replay != nullptr)
+					m_replay->WriteDisconnect(it->second->controller->GetNetworkOwnerID());
 				OObject::Destroy(it->second->controller);
 
 				delete it->second;
@@ -67,7 +118,7 @@ void NetHostSession::NetUpdate(const float& deltaTime)
 				// Send handshake response
 				ByteBuffer response;
 				EncodeHandshakeResponse(NetResponseCode::ServerInternalError, response, nullptr);
-				m_TcpSocket.SendTo(response.Data(), response.Size(), it->first);
+				m_TcpSocket->SendTo(response.Data(), response.Size(), it->first);
 
 				// Forcefully destroy as it wasn't added to the game yet
 				it->second->controller->OnDestroy();
@@ -88,7 +139,7 @@ void NetHostSession::NetUpdate(const float& deltaTime)
 				{
 					ByteBuffer response;
 					EncodeHandshakeResponse(NetResponseCode::Accepted, response, it->second->controller);
-					m_TcpSocket.SendTo(response.Data(), response.Size(), it->first);
+					m_TcpSocket->SendTo(response.Data(), response.Size(), it->first);
 					it->second->inactivityTimer = 0; // Reset timer
 					it->second->state = NetPlayerConnection::State::Connected;
 					LOG("Player(%i) connected from %s:%i", it->second->controller->GetNetworkOwnerID(), it->first.ip.toString().c_str(), it->first.port);
@@ -99,7 +150,7 @@ void NetHostSession::NetUpdate(const float& deltaTime)
 				{
 					ByteBuffer response;
 					EncodeHandshakeResponse(status, response, nullptr);
-					m_TcpSocket.SendTo(response.Data(), response.Size(), it->first);
+					m_TcpSocket->SendTo(response.Data(), response.Size(), it->first);
 
 					// Forcefully destroy as it wasn't added to the game yet
 					delete it->second->controller;
@@ -121,7 +172,14 @@ void NetHostSession::NetUpdate(const float& deltaTime)
 	std::vector<RawNetPacket> packets;
 
 	// Fetch TCP packets
-	if (m_TcpSocket.Poll(packets))
+	bool hasPackets;
+	{
+		NET_TRACE_SCOPE("PollTCP");
+		hasPackets = m_TcpSocket->Poll(packets);
+	}
+	NET_TRACE_COUNTER("PacketsTCP", packets.size());
+
+	if (hasPackets)
 		for (RawNetPacket& packet : packets)
 		{
 			packet.buffer.Flip();
@@ -139,7 +197,7 @@ void NetHostSession::NetUpdate(const float& deltaTime)
 				{
 					ByteBuffer response;
 					EncodeHandshakeResponse(status, response, player);
-					m_TcpSocket.SendTo(response.Data(), response.Size(), packet.source);
+					m_TcpSocket->SendTo(response.Data(), response.Size(), packet.source);
 
 					playerConnection = new NetPlayerConnection;
 					playerConnection->identity = packet.source;
@@ -164,13 +222,16 @@ void NetHostSession::NetUpdate(const float& deltaTime)
 				{
 					ByteBuffer response;
 					EncodeHandshakeResponse(status, response, nullptr);
-					m_TcpSocket.SendTo(response.Data(), response.Size(), packet.source);
+					m_TcpSocket->SendTo(response.Data(), response.Size(), packet.source);
 				}
 			}
 
 			// Player already connected (So just attempt to decode)
 			else if(playerConnection->state == NetPlayerConnection::State::Connected)
 			{
+				NET_TRACE_SCOPE_ARG("DecodeTCP", playerConnection->controller->GetNetworkOwnerID());
+				if (m_replay != nullptr)
+					m_replay->WriteUpdate(playerConnection->controller->GetNetworkOwnerID(), packet.buffer, TCP);
 				DecodeNetUpdate(playerConnection, packet.buffer, TCP);
 				playerConnection->inactivityTimer = -deltaTime;
 			}
@@ -179,7 +240,13 @@ void NetHostSession::NetUpdate(const float& deltaTime)
 
 	// Fetch UDP packets
 	packets.clear();
-	if (m_UdpSocket.Poll(packets))
+	{
+		NET_TRACE_SCOPE("PollUDP");
+		hasPackets = m_UdpSocket->Poll(packets);
+	}
+	NET_TRACE_COUNTER("PacketsUDP", packets.size());
+
+	if (hasPackets)
 		for (RawNetPacket& packet : packets)
 		{
 			packet.buffer.Flip();
@@ -188,6 +255,9 @@ void NetHostSession::NetUpdate(const float& deltaTime)
 			NetPlayerConnection* playerConnection;
 			if (GetPlayerFromIdentity(packet.source, playerConnection) && playerConnection->state == NetPlayerConnection::State::Connected)
 			{
+				NET_TRACE_SCOPE_ARG("DecodeUDP", playerConnection->controller->GetNetworkOwnerID());
+				if (m_replay != nullptr)
+					m_replay->WriteUpdate(playerConnection->controller->GetNetworkOwnerID(), packet.buffer, UDP);
 				DecodeNetUpdate(playerConnection, packet.buffer, UDP);
 				playerConnection->inactivityTimer = -deltaTime;
 			}
@@ -200,20 +270,34 @@ void NetHostSession::NetUpdate(const float& deltaTime)
 	////
 	ByteBuffer tcpContent;
 	ByteBuffer udpContent;
+	uint32 bytesSent = 0;
 
 	// Send out packet update
 	for (auto& it : m_connectionLookup)
 	{
 		tcpContent.Clear();
 		udpContent.Clear();
-		EncodeNetUpdate(it.second, tcpContent, TCP);
-		EncodeNetUpdate(it.second, udpContent, UDP);
+		{
+			NET_TRACE_SCOPE_ARG("Encode", it.second->controller->GetNetworkOwnerID());
+			EncodeNetUpdate(it.second, tcpContent, TCP);
+			EncodeNetUpdate(it.second, udpContent, UDP);
+		}
 
-		const NetIdentity& identity = it.first;
-		m_TcpSocket.SendTo(tcpContent.Data(), tcpContent.Size(), identity); // Will return false in event of disconnect, so could use this?
-		m_UdpSocket.SendTo(udpContent.Data(), udpContent.Size(), identity);
+		{
+			NET_TRACE_SCOPE_ARG("Send", it.second->controller->GetNetworkOwnerID());
+			const NetIdentity& identity = it.first;
+			m_TcpSocket->SendTo(tcpContent.Data(), tcpContent.Size(), identity); // Will return false in event of disconnect, so could use this?
+			m_UdpSocket->SendTo(udpContent.Data(), udpContent.Size(), identity);
+		}
+		bytesSent += tcpContent.Size() + udpContent.Size();
 		it.second->bJustLoadedLevel = false; // Reset flag for next update
 	}
+	NET_TRACE_COUNTER("BytesSent", bytesSent);
+
+
+	// Let the replay check it's still in step
+	if (m_replay != nullptr && NET_REPLAY_CHECKSUM_INTERVAL != 0 && ++m_replayNetTicks % NET_REPLAY_CHECKSUM_INTERVAL == 0)
+		m_replay->WriteChecksum(ComputeStateChecksum());
 }
 
 
@@ -307,7 +391,13 @@ void NetHostSession::EncodeHandshakeResponse(const NetResponseCode& code, ByteBu
 			Encode<uint16>(outBuffer, player->m_networkId);
 			Encode<uint16>(outBuffer, m_maxPlayerCount);					// Player limit
 			Encode<string>(outBuffer, m_sessionName);						// Server name
-			player->EncodeSyncVarRequests(player->m_networkOwnerId, outBuffer, TCP, true);
+
+			const uint32 stateStart = outBuffer.Size();
+			player->EncodeSyncVarRequests(player->m_networkOwnerId, outBuffer, TCP, true, player->GetClass());
+
+			// Replay builds the player from the same state the client is given
+			if (m_replay != nullptr)
+				m_replay->WriteConnect(player->m_networkOwnerId, player->m_networkId, outBuffer.Data() + stateStart, outBuffer.Size() - stateStart);
 			break;
 		}
 
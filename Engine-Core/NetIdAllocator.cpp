@@ -0,0 +1,64 @@
+#include "Includes/Core/NetIdAllocator.h"
+#include "Includes/Core/Logger.h"
+
+
+NetIdAllocator::NetIdAllocator(const float& quarantineDuration) :
+	m_quarantineDuration(quarantineDuration)
+{
+}
+
+void NetIdAllocator::HandleUpdate(const float& deltaTime)
+{
+	m_time += deltaTime;
+}
+
+uint16 NetIdAllocator::New()
+{
+	// Reuse oldest released id, if it has finished quarantine
+	if (!m_quarantine.empty() && m_time - m_quarantine.front().releaseTime >= m_quarantineDuration)
+	{
+		const uint16 id = m_quarantine.front().id;
+		m_quarantine.pop_front();
+		m_isReleased[id] = false;
+		return id;
+	}
+
+	// Make new id
+	if (!bIsExhausted)
+	{
+		const uint16 id = m_nextId++;
+		if (m_nextId == 0)
+			bIsExhausted = true;
+		return id;
+	}
+
+	// Every id has been handed out, so have to cut quarantine short
+	if (!m_quarantine.empty())
+	{
+		LOG_WARNING("Net ids exhausted, reusing id %i before quarantine has finished", m_quarantine.front().id);
+		const uint16 id = m_quarantine.front().id;
+		m_quarantine.pop_front();
+		m_isReleased[id] = false;
+		return id;
+	}
+
+	LOG_ERROR("Net ids exhausted, all %i ids are in use", 0xFFFF);
+	return 0;
+}
+
+void NetIdAllocator::Release(const uint16& id)
+{
+	if (id == 0)
+		return;
+
+	if (id >= m_isReleased.size())
+		m_isReleased.resize(id + 1, false);
+	else if (m_isReleased[id])
+	{
+		LOG_WARNING("Net id %i released twice, ignoring", id);
+		return;
+	}
+
+	m_isReleased[id] = true;
+	m_quarantine.push_back({ id, m_time });
+}
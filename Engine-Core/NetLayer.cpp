@@ -1,4 +1,4 @@
-#include "Includes\Core\NetLayer.h"
+#include "Includes/Core/NetLayer.h"
 
 
 CLASS_SOURCE(NetLayer, CORE_API)
@@ -0,0 +1,291 @@
+#include "Includes/Core/NetLoopbackTransport.h"
+
+#include <algorithm>
+
+
+/**
+* First port handed out to sockets which don't ask for one
+*/
+#define LOOPBACK_EPHEMERAL_PORT 49152
+
+
+
+NetSocketLoopback::NetSocketLoopback(NetLoopbackTransport* transport, const SocketType& type) :
+	NetSocket(type),
+	m_transport(transport)
+{
+}
+
+NetSocketLoopback::~NetSocketLoopback()
+{
+	if (bIsBound)
+		Close();
+}
+
+bool NetSocketLoopback::Poll(std::vector<RawNetPacket>& outPackets)
+{
+	if (!bIsBound)
+		return false;
+
+	// Take everything which has arrived by now
+	const double time = m_transport->GetTime();
+	uint32 arrivedCount = 0;
+	bool received = false;
+
+	for (NetLoopbackPacket& packet : m_inbox)
+	{
+		if (packet.arrivalTime > time)
+			break;
+		++arrivedCount;
+
+		// Only listen to server's traffic, if not listener
+		if (!bIsListener && packet.source != m_identity)
+			continue;
+
+		RawNetPacket raw;
+		raw.source = packet.source;
+		raw.buffer = std::move(packet.buffer);
+		m_bytesReceived += raw.buffer.Size();
+
+		outPackets.emplace_back(std::move(raw));
+		received = true;
+	}
+
+	m_inbox.erase(m_inbox.begin(), m_inbox.begin() + arrivedCount);
+	return received;
+}
+
+bool NetSocketLoopback::SendTo(const uint8* data, uint32 count, NetIdentity identity)
+{
+	if (!bIsBound)
+		return false;
+
+	if (GetSocketType() == UDP)
+	{
+		if (count >= NET_PACKET_MAX)
+		{
+			LOG_ERROR("Packet exceeds maximum supported size (%i)", NET_PACKET_MAX);
+			return false;
+		}
+
+		// Nothing listening is the same as the packet being lost
+		NetSocketLoopback* target = m_transport->Find(UDP, identity);
+		if (target != nullptr)
+			m_transport->Transmit(this, target, data, count);
+	}
+	else
+	{
+		// Can only send over an open connection
+		if (!bIsListener && identity != m_identity)
+			return false;
+
+		NetSocketLoopback* target = m_transport->Find(TCP, identity);
+		if (target == nullptr)
+			return false;
+
+		// Listener can only send to sockets which connected to it
+		if (bIsListener && (target->IsListener() || target->m_identity != m_localIdentity))
+			return false;
+
+		m_transport->Transmit(this, target, data, count);
+	}
+
+	m_bytesSent += count;
+	return true;
+}
+
+bool NetSocketLoopback::Close()
+{
+	if (!bIsBound)
+	{
+		LOG_ERROR("Socket cannot close as it's not in use");
+		return false;
+	}
+
+	if (m_transport != nullptr)
+		m_transport->Unbind(this);
+
+	m_inbox.clear();
+	m_lastArrival.clear();
+	bIsBound = false;
+	bIsOpen = false;
+	return true;
+}
+
+bool NetSocketLoopback::Listen(NetIdentity identity)
+{
+	if (bIsBound)
+	{
+		LOG_ERROR("Socket cannot listen as it's already in use");
+		return false;
+	}
+
+	if (!m_transport->Bind(this, identity))
+	{
+		LOG_ERROR("Failed to setup loopback listener on %s:%i", identity.ip.toString().c_str(), identity.port);
+		return false;
+	}
+
+	m_identity = m_localIdentity;
+	bIsListener = true;
+	bIsOpen = true;
+	return true;
+}
+
+bool NetSocketLoopback::Connect(NetIdentity identity)
+{
+	return ConnectAs(identity, NetIdentity(sf::IpAddress::LocalHost, 0));
+}
+
+bool NetSocketLoopback::ConnectAs(NetIdentity target, NetIdentity asIdentity)
+{
+	if (bIsBound)
+	{
+		LOG_ERROR("Socket cannot connect as it's already in use");
+		return false;
+	}
+
+	// TCP needs something to connect to
+	if (GetSocketType() == TCP)
+	{
+		NetSocketLoopback* listener = m_transport->Find(TCP, target);
+		if (listener == nullptr || !listener->IsListener())
+		{
+			LOG_ERROR("Failed to setup loopback socket to connection %s:%i (Nothing listening)", target.ip.toString().c_str(), target.port);
+			return false;
+		}
+	}
+
+	if (!m_transport->Bind(this, asIdentity))
+	{
+		LOG_ERROR("Failed to setup loopback socket to connection %s:%i as %s:%i", target.ip.toString().c_str(), target.port, asIdentity.ip.toString().c_str(), asIdentity.port);
+		return false;
+	}
+
+	m_identity = target;
+	bIsListener = false;
+	bIsOpen = true;
+	return true;
+}
+
+NetIdentity NetSocketLoopback::GetLocalIdentity()
+{
+	return bIsBound ? m_localIdentity : m_identity;
+}
+
+void NetSocketLoopback::Receive(NetLoopbackPacket& packet)
+{
+	// Keep inbox in arrival order (Sequence always increases, so ties stay in send order)
+	auto it = std::upper_bound(m_inbox.begin(), m_inbox.end(), packet.arrivalTime,
+		[](const double& time, const NetLoopbackPacket& other) { return time < other.arrivalTime; }
+	);
+	m_inbox.insert(it, std::move(packet));
+}
+
+
+
+NetLoopbackTransport::NetLoopbackTransport(const NetLoopbackSettings& settings) :
+	m_settings(settings),
+	m_random(settings.seed),
+	m_portCounter(LOOPBACK_EPHEMERAL_PORT)
+{
+}
+
+NetLoopbackTransport::~NetLoopbackTransport()
+{
+	// Sockets should have been deleted first, but make sure they don't call back into this
+	if (m_sockets.size() != 0)
+		LOG_WARNING("Loopback transport destroyed with %i sockets still bound", (uint32)m_sockets.size());
+
+	for (auto& it : m_sockets)
+	{
+		it.second->m_transport = nullptr;
+		it.second->Close();
+	}
+}
+
+NetSocket* NetLoopbackTransport::BuildSocket(const SocketType& type)
+{
+	return new NetSocketLoopback(this, type);
+}
+
+bool NetLoopbackTransport::Bind(NetSocketLoopback* socket, NetIdentity identity)
+{
+	const SocketType type = socket->GetSocketType();
+
+	// Find a free port (Kept free for both types, so a TCP connection's port can be reused by UDP)
+	if (identity.port == 0)
+	{
+		do
+		{
+			identity.port = m_portCounter++;
+			if (m_portCounter == 0)
+				m_portCounter = LOOPBACK_EPHEMERAL_PORT;
+		}
+		while (Find(TCP, identity) != nullptr || Find(UDP, identity) != nullptr);
+	}
+	else if (Find(type, identity) != nullptr)
+		return false;
+
+	m_sockets[std::make_pair(type, identity)] = socket;
+	socket->m_localIdentity = identity;
+	socket->bIsBound = true;
+	return true;
+}
+
+void NetLoopbackTransport::Unbind(NetSocketLoopback* socket)
+{
+	auto it = m_sockets.find(std::make_pair(socket->GetSocketType(), socket->m_localIdentity));
+	if (it != m_sockets.end() && it->second == socket)
+		m_sockets.erase(it);
+}
+
+NetSocketLoopback* NetLoopbackTransport::Find(const SocketType& type, const NetIdentity& identity) const
+{
+	auto it = m_sockets.find(std::make_pair(type, identity));
+	return it == m_sockets.end() ? nullptr : it->second;
+}
+
+void NetLoopbackTransport::Transmit(NetSocketLoopback* source, NetSocketLoopback* target, const uint8* data, const uint32& count)
+{
+	++m_packetsSent;
+
+	// Only UDP is unreliable
+	if (source->GetSocketType() == UDP && m_settings.lossRate > 0.0f)
+	{
+		if (std::uniform_real_distribution<float>(0.0f, 1.0f)(m_random) < m_settings.lossRate)
+		{
+			++m_packetsDropped;
+			return;
+		}
+	}
+
+	// Packets queue up behind each other, if the link is saturated
+	double sentTime = m_time;
+	if (m_settings.bandwidth != 0)
+	{
+		const double startTime = std::max(m_time, source->m_linkFreeTime);
+		source->m_linkFreeTime = startTime + (double)count / (double)m_settings.bandwidth;
+		sentTime = source->m_linkFreeTime;
+	}
+
+	double arrivalTime = sentTime + m_settings.latency;
+	if (m_settings.jitter > 0.0f)
+		arrivalTime += std::uniform_real_distribution<float>(0.0f, m_settings.jitter)(m_random);
+
+	// TCP can't overtake itself
+	if (source->GetSocketType() == TCP)
+	{
+		double& lastArrival = source->m_lastArrival[target->m_localIdentity];
+		arrivalTime = std::max(arrivalTime, lastArrival);
+		lastArrival = arrivalTime;
+	}
+
+
+	NetLoopbackPacket packet;
+	packet.source = source->m_localIdentity;
+	packet.buffer.Push(data, count);
+	packet.arrivalTime = arrivalTime;
+	packet.sequence = m_sequence++;
+	target->Receive(packet);
+}
@@ -0,0 +1,177 @@
+#include "Includes/Core/NetProfiler.h"
+#include "Includes/Core/ManagedClass.h"
+
+#include <unordered_map>
+#include <algorithm>
+
+
+/**
+* An entry along with what was spent on it since the last report
+*/
+struct NetProfileStats
+{
+	NetProfileEntry entry;
+	uint64 reportBytes = 0;
+	uint32 reportCount = 0;
+};
+
+
+bool NetProfiler::bIsEnabled = false;
+
+static std::unordered_map<uint64, NetProfileStats> s_stats;
+static uint64 s_totalBytes = 0;
+static float s_reportTimer = 0.0f;
+
+
+/**
+* Pack everything that identifies an entry into a single key
+*/
+static inline uint64 MakeKey(const MClass* classType, const NetProfileKind& kind, const uint16& index, const SocketType& socket)
+{
+	return ((uint64)classType->GetID() << 32) | ((uint64)kind << 24) | ((uint64)socket << 16) | (uint64)index;
+}
+
+static inline bool CompareBytes(const NetProfileEntry& a, const NetProfileEntry& b)
+{
+	return a.bytes > b.bytes;
+}
+
+static const char* GetKindName(const NetProfileKind& kind)
+{
+	switch (kind)
+	{
+	case NetProfileKind::Header:
+		return "Header";
+	case NetProfileKind::SyncVar:
+		return "SyncVar";
+	case NetProfileKind::RPC:
+		return "RPC";
+	}
+	return "Unknown";
+}
+
+
+void NetProfiler::Enable()
+{
+	bIsEnabled = true;
+	s_reportTimer = 0.0f;
+	LOG("Net profiler enabled");
+}
+
+void NetProfiler::Disable()
+{
+	bIsEnabled = false;
+}
+
+void NetProfiler::Reset()
+{
+	s_stats.clear();
+	s_totalBytes = 0;
+	s_reportTimer = 0.0f;
+}
+
+void NetProfiler::Record(const MClass* classType, const NetProfileKind& kind, const uint16& index, const SocketType& socket, const uint32& bytes)
+{
+	if (!bIsEnabled || classType == nullptr)
+		return;
+
+	NetProfileStats& stats = s_stats[MakeKey(classType, kind, index, socket)];
+	if (stats.entry.count == 0)
+	{
+		stats.entry.classType = classType;
+		stats.entry.kind = kind;
+		stats.entry.index = index;
+		stats.entry.socket = socket;
+	}
+
+	stats.entry.bytes += bytes;
+	++stats.entry.count;
+	stats.reportBytes += bytes;
+	++stats.reportCount;
+	s_totalBytes += bytes;
+}
+
+void NetProfiler::HandleUpdate(const float& deltaTime)
+{
+	if (!bIsEnabled)
+		return;
+
+	s_reportTimer += deltaTime;
+	if (s_reportTimer >= NET_PROFILE_REPORT_INTERVAL)
+	{
+		LogReport();
+		s_reportTimer = 0.0f;
+	}
+}
+
+void NetProfiler::LogReport(const uint32& count)
+{
+	// Sort by what has been spent since the last report
+	std::vector<NetProfileStats*> recent;
+	uint64 recentBytes = 0;
+	for (auto& it : s_stats)
+		if (it.second.reportCount != 0)
+		{
+			recent.emplace_back(&it.second);
+			recentBytes += it.second.reportBytes;
+		}
+
+	std::sort(recent.begin(), recent.end(), [](const NetProfileStats* a, const NetProfileStats* b) { return a->reportBytes > b->reportBytes; });
+
+	LOG("Net profile (%llu bytes since last report, %llu bytes total):", (unsigned long long)recentBytes, (unsigned long long)s_totalBytes);
+	for (uint32 i = 0; i < recent.size() && i < count; ++i)
+	{
+		const NetProfileStats& stats = *recent[i];
+		LOG("\t-%s %s[%i] %s: %llu bytes over %i encodes (%.1f%%)",
+			stats.entry.classType->GetName().c_str(),
+			GetKindName(stats.entry.kind),
+			stats.entry.index,
+			stats.entry.socket == TCP ? "TCP" : "UDP",
+			(unsigned long long)stats.reportBytes,
+			stats.reportCount,
+			recentBytes == 0 ? 0.0f : 100.0f * (float)stats.reportBytes / (float)recentBytes
+		);
+	}
+
+	for (auto& it : s_stats)
+	{
+		it.second.reportBytes = 0;
+		it.second.reportCount = 0;
+	}
+}
+
+std::vector<NetProfileEntry> NetProfiler::GetEntries()
+{
+	std::vector<NetProfileEntry> entries;
+	entries.reserve(s_stats.size());
+	for (auto& it : s_stats)
+		entries.emplace_back(it.second.entry);
+
+	std::sort(entries.begin(), entries.end(), CompareBytes);
+	return entries;
+}
+
+std::vector<NetProfileEntry> NetProfiler::GetEntries(const MClass* classType)
+{
+	std::vector<NetProfileEntry> entries;
+	for (auto& it : s_stats)
+		if (it.second.entry.classType == classType)
+			entries.emplace_back(it.second.entry);
+
+	std::sort(entries.begin(), entries.end(), CompareBytes);
+	return entries;
+}
+
+uint64 NetProfiler::GetClassBytes(const MClass* classType)
+{
+	uint64 bytes = 0;
+	for (auto& it : s_stats)
+		if (it.second.entry.classType == classType)
+			bytes += it.second.entry.bytes;
+	return bytes;
+}
+
+uint64 NetProfiler::GetTotalBytes()
+{
+	return s_totalBytes;
+}
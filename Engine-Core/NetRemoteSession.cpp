@@ -1,12 +1,12 @@
-#include "Includes\Core\NetRemoteSession.h"
-#include "Includes\Core\Engine.h"
-#include "Includes\Core\Game.h"
-#include "Includes\Core\Level.h"
+#include "Includes/Core/NetRemoteSession.h"
+#include "Includes/Core/Engine.h"
+#include "Includes/Core/Game.h"
+#include "Includes/Core/Level.h"
 
 
 
-NetRemoteSession::NetRemoteSession(Game* game, const NetIdentity identity) :
-	NetSession(game, identity)
+NetRemoteSession::NetRemoteSession(Game* game, const NetIdentity identity, NetTransport* transport) :
+	NetSession(game, identity, transport)
 {
 	bIsHost = false;
 }
@@ -20,12 +20,12 @@ bool NetRemoteSession::Start()
 {
 	const NetIdentity& remote = GetSessionIdentity();
 
-	if (!m_TcpSocket.Connect(remote))
+	if (!m_TcpSocket->Connect(remote))
 	{
 		LOG_ERROR("Unable to connect to net session (%s:%i). TCP error.", remote.ip.toString().c_str(), remote.port);
 		return false;
 	}
-	if (!m_UdpSocket.ConnectAs(remote, m_TcpSocket.GetLocalIdentity()))
+	if (!m_UdpSocket->ConnectAs(remote, m_TcpSocket->GetLocalIdentity()))
 	{
 		LOG_ERROR("Unable to connect to net session (%s:%i). UDP error.", remote.ip.toString().c_str(), remote.port);
 		return false;
@@ -60,9 +60,17 @@ void NetRemoteSession::NetUpdate(const float& deltaTime)
 	std::vector<RawNetPacket> packets;
 
 	// Fetch TCP packets
-	if (m_TcpSocket.Poll(packets))
+	bool hasPackets;
+	{
+		NET_TRACE_SCOPE("PollTCP");
+		hasPackets = m_TcpSocket->Poll(packets);
+	}
+	NET_TRACE_COUNTER("PacketsTCP", packets.size());
+
+	if (hasPackets)
 		for (RawNetPacket& packet : packets)
 		{
+			NET_TRACE_SCOPE("DecodeTCP");
 			packet.buffer.Flip();
 			DecodeNetUpdate(nullptr, packet.buffer, TCP);
 			m_inactivityTimer = 0;
@@ -70,9 +78,16 @@ void NetRemoteSession::NetUpdate(const float& deltaTime)
 
 	// Fetch UDP packets
 	packets.clear();
-	if (m_UdpSocket.Poll(packets))
+	{
+		NET_TRACE_SCOPE("PollUDP");
+		hasPackets = m_UdpSocket->Poll(packets);
+	}
+	NET_TRACE_COUNTER("PacketsUDP", packets.size());
+
+	if (hasPackets)
 		for (RawNetPacket& packet : packets)
 		{
+			NET_TRACE_SCOPE("DecodeUDP");
 			packet.buffer.Flip();
 			DecodeNetUpdate(nullptr, packet.buffer, UDP);
 			m_inactivityTimer = 0;
@@ -86,12 +101,19 @@ void NetRemoteSession::NetUpdate(const float& deltaTime)
 	ByteBuffer tcpContent;
 	ByteBuffer udpContent;
 
-	EncodeNetUpdate(nullptr, tcpContent, TCP);
-	EncodeNetUpdate(nullptr, udpContent, UDP);
+	{
+		NET_TRACE_SCOPE("Encode");
+		EncodeNetUpdate(nullptr, tcpContent, TCP);
+		EncodeNetUpdate(nullptr, udpContent, UDP);
+	}
 
-	const NetIdentity& identity = GetSessionIdentity();
-	m_TcpSocket.SendTo(tcpContent.Data(), tcpContent.Size(), identity); // Will return false in event of disconnect, so could use this?
-	m_UdpSocket.SendTo(udpContent.Data(), udpContent.Size(), identity);
+	{
+		NET_TRACE_SCOPE("Send");
+		const NetIdentity& identity = GetSessionIdentity();
+		m_TcpSocket->SendTo(tcpContent.Data(), tcpContent.Size(), identity); // Will return false in event of disconnect, so could use this?
+		m_UdpSocket->SendTo(udpContent.Data(), udpContent.Size(), identity);
+	}
+	NET_TRACE_COUNTER("BytesSent", tcpContent.Size() + udpContent.Size());
 }
 
 bool NetRemoteSession::EnsureConnection() 
@@ -101,7 +123,7 @@ bool NetRemoteSession::EnsureConnection()
 	{
 		ByteBuffer content;
 		EncodeHandshake(content);
-		if (!m_TcpSocket.Send(content.Data(), content.Size()))
+		if (!m_TcpSocket->Send(content.Data(), content.Size()))
 		{
 			LOG_ERROR("Failed to send handshake");
 		}
@@ -117,12 +139,19 @@ bool NetRemoteSession::EnsureConnection()
 		std::vector<RawNetPacket> packets;
 
 		// Attempt to decode handshake response
-		if (m_TcpSocket.Poll(packets))
+		if (m_TcpSocket->Poll(packets))
 		{
 			for (RawNetPacket& p : packets)
 			{
 				p.buffer.Flip();
 
+				// Anything after the response in the same poll is already a net update
+				if (m_clientStatus == Connected)
+				{
+					DecodeNetUpdate(nullptr, p.buffer, TCP);
+					continue;
+				}
+
 				switch (DecodeHandshakeResponse(p.buffer, m_localController))
 				{
 					// Unknown should never be returned, so just rubbish?
@@ -236,10 +265,8 @@ NetResponseCode NetRemoteSession::DecodeHandshakeResponse(ByteBuffer& inBuffer,
 
 
 		// Remove existing controllers
-		std::vector<OPlayerController*> players = GetGame()->GetActiveObjects<OPlayerController>();
-
-		for (uint32 i = 0; i < players.size(); ++i)
-			OObject::Destroy(players[i]);
+		for (OPlayerController* player : GetGame()->GetActiveObjects<OPlayerController>())
+			OObject::Destroy(player);
 		
 
 
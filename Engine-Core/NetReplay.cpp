@@ -0,0 +1,197 @@
+#include "Includes/Core/NetReplay.h"
+
+#include <iterator>
+
+
+
+NetReplayWriter::~NetReplayWriter()
+{
+	if (IsOpen())
+		Close();
+}
+
+bool NetReplayWriter::Open(const string& path, const NetReplayHeader& header)
+{
+	if (IsOpen())
+		Close();
+
+	m_file.open(path, std::ios::binary | std::ios::trunc);
+	if (!m_file.good())
+	{
+		LOG_ERROR("Unable to open replay '%s' for writing", path.c_str());
+		return false;
+	}
+
+	m_path = path;
+	m_buffer.Clear();
+	m_pendingTicks = 0;
+	m_bytesWritten = 0;
+
+	Encode<NetReplayHeader>(m_buffer, header);
+	Flush();
+
+	LOG("Recording replay to '%s'", path.c_str());
+	return true;
+}
+
+void NetReplayWriter::Close()
+{
+	Flush();
+	m_file.close();
+	LOG("Closed replay '%s' (%i KB)", m_path.c_str(), (uint32)(m_bytesWritten / 1024));
+}
+
+void NetReplayWriter::Flush()
+{
+	if (m_buffer.Size() == 0)
+		return;
+
+	m_file.write((const char*)m_buffer.Data(), m_buffer.Size());
+	m_file.flush();
+	m_bytesWritten += m_buffer.Size();
+
+	m_buffer.Clear();
+	m_pendingTicks = 0;
+}
+
+void NetReplayWriter::WriteTick(const float& deltaTime)
+{
+	if (++m_pendingTicks >= NET_REPLAY_FLUSH_TICKS)
+		Flush();
+
+	Encode<uint8>(m_buffer, (uint8)NetReplayRecord::Tick);
+	Encode<float>(m_buffer, deltaTime);
+}
+
+void NetReplayWriter::WriteConnect(const uint16& ownerId, const uint16& netId, const uint8* state, const uint32& count)
+{
+	Encode<uint8>(m_buffer, (uint8)NetReplayRecord::Connect);
+	Encode<uint16>(m_buffer, ownerId);
+	Encode<uint16>(m_buffer, netId);
+	Encode<uint32>(m_buffer, count);
+	m_buffer.Push(state, count);
+}
+
+void NetReplayWriter::WriteDisconnect(const uint16& ownerId)
+{
+	Encode<uint8>(m_buffer, (uint8)NetReplayRecord::Disconnect);
+	Encode<uint16>(m_buffer, ownerId);
+}
+
+void NetReplayWriter::WriteUpdate(const uint16& ownerId, const ByteBuffer& buffer, const SocketType& socketType)
+{
+	Encode<uint8>(m_buffer, (uint8)(socketType == TCP ? NetReplayRecord::TcpUpdate : NetReplayRecord::UdpUpdate));
+	Encode<uint16>(m_buffer, ownerId);
+	Encode<uint32>(m_buffer, buffer.Size());
+
+	// Buffer has already been flipped for decoding, so store it back in wire order
+	const uint8* data = buffer.Data();
+	for (uint32 i = buffer.Size(); i != 0; --i)
+		m_buffer.Push(data[i - 1]);
+}
+
+void NetReplayWriter::WriteChecksum(const uint32& checksum)
+{
+	Encode<uint8>(m_buffer, (uint8)NetReplayRecord::Checksum);
+	Encode<uint32>(m_buffer, checksum);
+}
+
+
+
+bool NetReplayReader::Open(const string& path)
+{
+	std::ifstream file(path, std::ios::binary);
+	if (!file.good())
+	{
+		LOG_ERROR("Unable to open replay '%s'", path.c_str());
+		return false;
+	}
+
+	std::vector<uint8> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	m_buffer.Clear();
+	m_buffer.Push(data.data(), data.size());
+	m_buffer.Flip();
+
+	if (!Decode<NetReplayHeader>(m_buffer, m_header))
+	{
+		LOG_ERROR("'%s' is not a supported replay (Expected version %i)", path.c_str(), NET_REPLAY_VERSION);
+		m_buffer.Clear();
+		return false;
+	}
+
+	LOG("Loaded replay '%s' (%i KB)", path.c_str(), (uint32)(data.size() / 1024));
+	return true;
+}
+
+bool NetReplayReader::Next(NetReplayRecord& outRecord)
+{
+	if (!Peek(outRecord))
+		return false;
+
+	m_buffer.Pop();
+	return true;
+}
+
+bool NetReplayReader::Peek(NetReplayRecord& outRecord) const
+{
+	if (IsFinished())
+		return false;
+
+	outRecord = (NetReplayRecord)m_buffer.Peek();
+	return true;
+}
+
+bool NetReplayReader::ReadTick(float& outDeltaTime)
+{
+	if (!Decode<float>(m_buffer, outDeltaTime))
+		return Truncated();
+	return true;
+}
+
+bool NetReplayReader::ReadConnect(uint16& outOwnerId, uint16& outNetId, ByteBuffer& outState)
+{
+	uint32 count;
+	if (!Decode<uint16>(m_buffer, outOwnerId) ||
+		!Decode<uint16>(m_buffer, outNetId) ||
+		!Decode<uint32>(m_buffer, count) ||
+		m_buffer.Size() < count)
+		return Truncated();
+
+	outState.Clear();
+	m_buffer.PopBuffer(outState, count);
+	return true;
+}
+
+bool NetReplayReader::ReadDisconnect(uint16& outOwnerId)
+{
+	if (!Decode<uint16>(m_buffer, outOwnerId))
+		return Truncated();
+	return true;
+}
+
+bool NetReplayReader::ReadUpdate(uint16& outOwnerId, ByteBuffer& outBuffer)
+{
+	uint32 count;
+	if (!Decode<uint16>(m_buffer, outOwnerId) ||
+		!Decode<uint32>(m_buffer, count) ||
+		m_buffer.Size() < count)
+		return Truncated();
+
+	outBuffer.Clear();
+	m_buffer.PopBuffer(outBuffer, count);
+	return true;
+}
+
+bool NetReplayReader::ReadChecksum(uint32& outChecksum)
+{
+	if (!Decode<uint32>(m_buffer, outChecksum))
+		return Truncated();
+	return true;
+}
+
+bool NetReplayReader::Truncated()
+{
+	LOG_WARNING("Replay ends part way through a record (Ignoring the rest)");
+	m_buffer.Clear();
+	return false;
+}
@@ -0,0 +1,206 @@
+#include "Includes/Core/NetReplaySession.h"
+#include "Includes/Core/Game.h"
+#include "Includes/Core/Level.h"
+
+#include <cstdio>
+
+
+NetReplaySession::NetReplaySession(Game* game, const string& path, const Version& engineVersion) :
+	NetSession(game, NetIdentity()),
+	m_path(path),
+	m_engineVersion(engineVersion)
+{
+	bIsHost = true;
+}
+
+NetReplaySession::~NetReplaySession()
+{
+	for (auto& it : m_connectionLookup)
+		delete it.second;
+	LOG("NetReplaySession destroyed.");
+}
+
+bool NetReplaySession::Start()
+{
+	if (!m_reader.Open(m_path))
+		return false;
+
+	const NetReplayHeader& header = m_reader.GetHeader();
+	if (header.engineVersion != m_engineVersion || header.gameVersion != GetGame()->GetVersionNo())
+	{
+		LOG_ERROR("Unable to play replay, as it was recorded by a different build (Engine %i.%i.%i, Game %i.%i.%i)",
+			header.engineVersion.major, header.engineVersion.minor, header.engineVersion.patch,
+			header.gameVersion.major, header.gameVersion.minor, header.gameVersion.patch
+		);
+		return false;
+	}
+
+	const MClass* levelClass = GetGame()->GetLevelClass(header.levelClass);
+	if (levelClass == nullptr)
+	{
+		LOG_ERROR("Unable to play replay, as it opens on an unregistered level (id:%i)", header.levelClass);
+		return false;
+	}
+
+
+	// Start from the same state as the host
+	GetGame()->defaultNetLevel = levelClass;
+	LLevel::s_instanceCounter = header.levelInstanceCounter;
+	srand(header.seed);
+
+	SetTickRate(header.tickRate);
+	SetMaxPlayerCount(header.maxPlayerCount);
+	SetSessionName(header.sessionName);
+
+	bIsConnected = true;
+	LOG("Replay net session openned for '%s' (%s)", m_path.c_str(), m_sessionName.c_str());
+	return true;
+}
+
+bool NetReplaySession::NextTick(float& outDeltaTime)
+{
+	NetReplayRecord record;
+	while (m_reader.Next(record))
+	{
+		if (record == NetReplayRecord::Tick)
+		{
+			if (!m_reader.ReadTick(outDeltaTime))
+				return false;
+
+			++m_tickCount;
+			return true;
+		}
+
+		// Anything else should have been applied by the last net update
+		OnDesync("Record fell outside of a net update");
+		ApplyRecord(record);
+	}
+
+	return false;
+}
+
+void NetReplaySession::NetUpdate(const float& deltaTime)
+{
+	// Apply everything the host decoded in this net update
+	NetReplayRecord record;
+	while (m_reader.Peek(record) && record != NetReplayRecord::Tick)
+	{
+		m_reader.Next(record);
+		ApplyRecord(record);
+	}
+
+	for (auto& it : m_connectionLookup)
+		it.second->bJustLoadedLevel = false; // Reset flag for next update
+}
+
+void NetReplaySession::ApplyRecord(const NetReplayRecord& record)
+{
+	switch (record)
+	{
+		case NetReplayRecord::Connect:
+		{
+			uint16 ownerId;
+			uint16 netId;
+			ByteBuffer state;
+			if (!m_reader.ReadConnect(ownerId, netId, state))
+				return;
+
+			// Apply the state the host gave the client (Role isn't set yet, so it will be accepted)
+			OPlayerController* player = GetGame()->playerControllerClass->New<OPlayerController>();
+			player->m_decodingContext = GetGame();
+			player->DecodeSyncVarRequests(0, state, TCP, true);
+
+			player->m_networkOwnerId = NewPlayerID();
+			player->m_networkId = NewObjectID();
+			if (player->m_networkOwnerId != ownerId || player->m_networkId != netId)
+				OnDesync("Player(" + std::to_string(ownerId) + ") was given different ids");
+
+			player->bFirstNetUpdate = true;
+			player->UpdateRole(this);
+			GetGame()->AddObject(player);
+			player->OnPostNetInitialize();
+
+			NetPlayerConnection* connection = new NetPlayerConnection;
+			connection->controller = player;
+			connection->state = NetPlayerConnection::State::Connected;
+			m_connectionLookup[ownerId] = connection;
+			LOG("Player(%i) connected from replay", ownerId);
+			return;
+		}
+
+		case NetReplayRecord::Disconnect:
+		{
+			uint16 ownerId;
+			if (!m_reader.ReadDisconnect(ownerId))
+				return;
+
+			auto it = m_connectionLookup.find(ownerId);
+			if (it == m_connectionLookup.end())
+			{
+				OnDesync("Player(" + std::to_string(ownerId) + ") disconnected without connecting");
+				return;
+			}
+
+			LOG("Player(%i) disconnected from replay", ownerId);
+			OObject::Destroy(it->second->controller);
+			delete it->second;
+			m_connectionLookup.erase(it);
+			return;
+		}
+
+		case NetReplayRecord::TcpUpdate:
+		case NetReplayRecord::UdpUpdate:
+		{
+			uint16 ownerId;
+			ByteBuffer buffer;
+			if (!m_reader.ReadUpdate(ownerId, buffer))
+				return;
+
+			auto it = m_connectionLookup.find(ownerId);
+			if (it == m_connectionLookup.end())
+			{
+				OnDesync("Update from Player(" + std::to_string(ownerId) + ") who isn't connected");
+				return;
+			}
+
+			DecodeNetUpdate(it->second, buffer, record == NetReplayRecord::TcpUpdate ? TCP : UDP);
+			return;
+		}
+
+		case NetReplayRecord::Checksum:
+		{
+			uint32 checksum;
+			if (!m_reader.ReadChecksum(checksum))
+				return;
+
+			const uint32 current = ComputeStateChecksum();
+			if (current == checksum)
+				++m_checksumsMatched;
+			else
+			{
+				++m_checksumsFailed;
+
+				char reason[64];
+				snprintf(reason, sizeof(reason), "Checksum %08x, recorded as %08x", current, checksum);
+				OnDesync(reason);
+			}
+			return;
+		}
+
+		default:
+			LOG_ERROR("Unknown replay record (%i) ignoring the rest of the replay", (uint32)record);
+			m_reader.Close();
+			return;
+	}
+}
+
+void NetReplaySession::OnDesync(const string& reason)
+{
+	// Only the first is interesting, as everything after will likely follow from it
+	if (!bIsInStep)
+		return;
+
+	bIsInStep = false;
+	m_desyncTick = m_tickCount;
+	LOG_WARNING("Replay out of step on tick %i (%s)", m_desyncTick, reason.c_str());
+}
@@ -1,5 +1,5 @@
-#include "Includes\Core\NetSerializableBase.h"
-#include "Includes\Core\NetSession.h"
+#include "Includes/Core/NetSerializableBase.h"
+#include "Includes/Core/NetSession.h"
 #include <cstring>
 
 
@@ -80,7 +80,7 @@ void NetSerializableBase::RemoteCallRPC(const RPCInfo& rpcInfo, const ByteBuffer
 }
 
 
-void NetSerializableBase::EncodeRPCRequests(const uint16& targetNetId, ByteBuffer& buffer, const SocketType& socketType)
+void NetSerializableBase::EncodeRPCRequests(const uint16& targetNetId, ByteBuffer& buffer, const SocketType& socketType, const MClass* profileClass)
 {
 	// Doesn't have control, so shouldn't even be here
 	if (!HasNetControl())
@@ -104,8 +104,12 @@ void NetSerializableBase::EncodeRPCRequests(const uint16& targetNetId, ByteBuffe
 			(request.function.callingMode == RPCCallingMode::Broadcast)
 		)
 		{
+			const uint32 startSize = callBuffer.Size();
 			Encode<RPCRequest>(callBuffer, request);
 			++callCount;
+
+			if (NetProfiler::IsEnabled())
+				NetProfiler::Record(profileClass, NetProfileKind::RPC, request.function.index, socketType, callBuffer.Size() - startSize);
 		}
 	}
 	
@@ -114,6 +118,9 @@ void NetSerializableBase::EncodeRPCRequests(const uint16& targetNetId, ByteBuffe
 	Encode<uint16>(buffer, callCount);
 	if(callCount != 0)
 		buffer.Push(callBuffer.Data(), callBuffer.Size());
+
+	if (NetProfiler::IsEnabled())
+		NetProfiler::Record(profileClass, NetProfileKind::Header, 0, socketType, sizeof(uint16));
 }
 
 void NetSerializableBase::DecodeRPCRequests(const uint16& sourceNetId, ByteBuffer& buffer, const SocketType& socketType)
@@ -152,8 +159,11 @@ void NetSerializableBase::DecodeRPCRequests(const uint16& sourceNetId, ByteBuffe
 }
 
 
-void NetSerializableBase::EncodeSyncVarRequests(const uint16& targetNetId, ByteBuffer& buffer, const SocketType& socketType, const bool& forceEncode)
+void NetSerializableBase::EncodeSyncVarRequests(const uint16& targetNetId, ByteBuffer& buffer, const SocketType& socketType, const bool& forceEncode, const MClass* profileClass)
 {
+	if (NetProfiler::IsEnabled())
+		NetProfiler::Record(profileClass, NetProfileKind::Header, 0, socketType, sizeof(uint16));
+
 	// Only host can sync vars
 	if (!IsNetHost())
 	{
@@ -179,8 +189,12 @@ void NetSerializableBase::EncodeSyncVarRequests(const uint16& targetNetId, ByteB
 	// Encode all var changes (Synced to every client)
 	for (const SyncVarRequest& request : *queue)
 	{
+		const uint32 startSize = callBuffer.Size();
 		Encode<SyncVarRequest>(callBuffer, request);
 		++count;
+
+		if (NetProfiler::IsEnabled())
+			NetProfiler::Record(profileClass, NetProfileKind::SyncVar, request.variable.index, socketType, callBuffer.Size() - startSize);
 	}
 
 	// Encode calls into main buffer
@@ -1,23 +1,26 @@
-#include "Includes\Core\NetSession.h"
-#include "Includes\Core\NetController.h"
-#include "Includes\Core\NetHostSession.h"
+#include "Includes/Core/NetSession.h"
+#include "Includes/Core/NetController.h"
+#include "Includes/Core/NetHostSession.h"
 
-#include "Includes\Core\Engine.h"
-#include "Includes\Core\Game.h"
-#include "Includes\Core\Level.h"
-#include "Includes\Core\Logger.h"
+#include "Includes/Core/Engine.h"
+#include "Includes/Core/Game.h"
+#include "Includes/Core/Level.h"
+#include "Includes/Core/Logger.h"
 
 
 
-NetSession::NetSession(Game* game, const NetIdentity identity) :
+NetSession::NetSession(Game* game, const NetIdentity identity, NetTransport* transport) :
 	m_game(game), m_netIdentity(identity)
 {
+	if (transport == nullptr)
+		transport = NetTransport::GetDefault();
+	m_TcpSocket = transport->BuildSocket(TCP);
+	m_UdpSocket = transport->BuildSocket(UDP);
+
 	m_sessionNetId = 0;
 
 	// 0 - Reservered as nullptr
 	m_playerIdCounter = 1;
-	m_objectNetIdCounter = 1; 
-	m_actorNetIdCounter = 1;
 
 	m_netLayer = nullptr;
 
@@ -27,6 +30,8 @@ NetSession::NetSession(Game* game, const NetIdentity identity) :
 NetSession::~NetSession()
 {
 	delete m_netLayer;
+	delete m_TcpSocket;
+	delete m_UdpSocket;
 }
 
 void NetSession::SetupLayer(SubClassOf<NetLayer> layerType, ConfigLayer configLayer) 
@@ -39,16 +44,33 @@ void NetSession::SetupLayer(SubClassOf<NetLayer> layerType, ConfigLayer configLa
 
 void NetSession::MainUpdate(const float& deltaTime) 
 {
+	m_objectIdAllocator.HandleUpdate(deltaTime);
+	m_actorIdAllocator.HandleUpdate(deltaTime);
+	NetProfiler::HandleUpdate(deltaTime);
+
 	m_tickTimer += deltaTime;
 	if (m_tickTimer < m_sleepRate)
 		return;
 
 	if (m_tickTimer >= m_sleepRate * 5.0f)
+	{
 		LOG_WARNING("Net update falling behind");
 
+		// Keep whatever led up to this, for offline analysis
+		if (NetTrace::IsEnabled() && (m_lastTraceDump == 0 || NetTrace::Now() - m_lastTraceDump >= NET_TRACE_SPIKE_COOLDOWN * 1000000ULL))
+		{
+			NetTrace::DumpBinary(NET_TRACE_SPIKE_PATH);
+			m_lastTraceDump = NetTrace::Now();
+		}
+	}
+
+	NET_TRACE_SCOPE("NetTick");
 	PreNetUpdate();
 
-	m_netLayer->OnNetTick(m_tickTimer);
+	{
+		NET_TRACE_SCOPE("NetLayer");
+		m_netLayer->OnNetTick(m_tickTimer);
+	}
 	NetUpdate(m_tickTimer);
 
 	PostNetUpdate();
@@ -57,6 +79,8 @@ void NetSession::MainUpdate(const float& deltaTime)
 
 void NetSession::PreNetUpdate() 
 {
+	NET_TRACE_SCOPE("PreNetUpdate");
+
 	// Assign ids to any new objects
 	for (OObject* object : GetGame()->GetActiveObjects())
 	{
@@ -72,7 +96,7 @@ void NetSession::PreNetUpdate()
 			object->m_networkId = NewObjectID();
 			object->bFirstNetUpdate = true;
 			object->UpdateRole(this);
-			GetGame()->m_netObjectLookup[object->m_networkId] = object;
+			GetGame()->m_netObjectLookup.Set(object->m_networkId, object);
 		}
 	}
 
@@ -94,13 +118,15 @@ void NetSession::PreNetUpdate()
 				actor->m_networkId = NewActorID();
 				actor->bFirstNetUpdate = true;
 				actor->UpdateRole(this);
-				level->m_netActorLookup[actor->m_networkId] = actor;
+				level->m_netActorLookup.Set(actor->m_networkId, actor);
 			}
 		}
 }
 
 void NetSession::PostNetUpdate() 
 {
+	NET_TRACE_SCOPE("PostNetUpdate");
+
 	// Clear object net queues
 	for (OObject* object : GetGame()->GetActiveObjects())
 	{
@@ -127,6 +153,53 @@ void NetSession::PostNetUpdate()
 	m_deletionQueue.clear();
 }
 
+uint32 NetSession::ComputeStateChecksum() const
+{
+	// FNV-1a
+	uint32 hash = 2166136261u;
+	auto mix = [&hash](const void* data, const uint32& count)
+	{
+		const uint8* bytes = (const uint8*)data;
+		for (uint32 i = 0; i < count; ++i)
+			hash = (hash ^ bytes[i]) * 16777619u;
+	};
+
+	for (OObject* object : GetGame()->GetActiveObjects())
+	{
+		if (!object->IsNetSynced() || object->IsDestroyed() || object->GetNetworkID() == 0)
+			continue;
+
+		const uint16 classId = object->GetClass()->GetID();
+		mix(&object->GetNetworkID(), sizeof(uint16));
+		mix(&classId, sizeof(uint16));
+	}
+
+
+	LLevel* level = GetGame()->GetCurrentLevel();
+	if (level == nullptr)
+		return hash;
+
+	const uint16 levelClass = level->GetClass()->GetID();
+	mix(&levelClass, sizeof(uint16));
+	mix(&level->GetInstanceID(), sizeof(uint16));
+
+	for (AActor* actor : level->GetActiveActors())
+	{
+		if (!actor->IsNetSynced() || actor->IsDestroyed() || actor->GetNetworkID() == 0)
+			continue;
+
+		const uint16 classId = actor->GetClass()->GetID();
+		const uint8 active = actor->IsActive() ? 1 : 0;
+		mix(&actor->GetNetworkID(), sizeof(uint16));
+		mix(&classId, sizeof(uint16));
+		mix(&active, sizeof(uint8));
+		mix(&actor->GetLocation().x, sizeof(float));
+		mix(&actor->GetLocation().y, sizeof(float));
+	}
+
+	return hash;
+}
+
 
 void NetSession::OnNetObjectDestroy(const OObject* object)
 {
@@ -134,11 +207,33 @@ void NetSession::OnNetObjectDestroy(const OObject* object)
 	if (!IsHost())
 		return;
 
+	// Actors of a level being torn down are handled by OnNetLevelDestroy
+	const AActor* actor = dynamic_cast<const AActor*>(object);
+	if (actor != nullptr && actor->GetLevel() != nullptr && actor->GetLevel()->bIsDestroying)
+		return;
+
 	// Queue needed info about deletion
 	NetObjectDeletion info;
-	info.bIsActor = dynamic_cast<const AActor*>(object) != nullptr;
+	info.bIsActor = actor != nullptr;
 	info.netId = object->GetNetworkID();
 	m_deletionQueue.emplace_back(info);
+
+	// Id can be reused once clients have had time to process the deletion
+	if (info.bIsActor)
+		m_actorIdAllocator.Release(info.netId);
+	else
+		m_objectIdAllocator.Release(info.netId);
+}
+
+void NetSession::OnNetLevelDestroy(const LLevel* level)
+{
+	if (!IsHost())
+		return;
+
+	// Destroyed actors have already released their ids
+	for (AActor* actor : level->m_activeActors)
+		if (!actor->IsDestroyed() && actor->GetNetworkID() != 0)
+			m_actorIdAllocator.Release(actor->GetNetworkID());
 }
 
 
@@ -162,6 +257,7 @@ void NetSession::EncodeNetObject(NetPlayerConnection* target, OObject* object, B
 			return;
 
 		// Encode new object information
+		const uint32 startSize = buffer.Size();
 		Encode<uint8>(buffer, (uint8)NetObjectMethod::New);
 		Encode<uint16>(buffer, object->GetNetworkID());
 		Encode<uint16>(buffer, object->GetNetworkOwnerID());
@@ -175,9 +271,12 @@ void NetSession::EncodeNetObject(NetPlayerConnection* target, OObject* object, B
 		else
 			Encode<uint32>(buffer, actor->GetInstanceID());
 
+		if (NetProfiler::IsEnabled())
+			NetProfiler::Record(object->GetClass(), NetProfileKind::Header, 0, socketType, buffer.Size() - startSize);
+
 
 		// Encode all sync var values for initial sync
-		object->EncodeSyncVarRequests(targetId, buffer, socketType, true);
+		object->EncodeSyncVarRequests(targetId, buffer, socketType, true, object->GetClass());
 		return;
 	}
 
@@ -188,8 +287,11 @@ void NetSession::EncodeNetObject(NetPlayerConnection* target, OObject* object, B
 
 	// Encode sync vars and rpcs
 	Encode<uint16>(buffer, object->GetNetworkID());
-	object->EncodeSyncVarRequests(targetId, buffer, socketType, false);
-	object->EncodeRPCRequests(targetId, buffer, socketType);
+	if (NetProfiler::IsEnabled())
+		NetProfiler::Record(object->GetClass(), NetProfileKind::Header, 0, socketType, sizeof(uint8) + sizeof(uint16));
+
+	object->EncodeSyncVarRequests(targetId, buffer, socketType, false, object->GetClass());
+	object->EncodeRPCRequests(targetId, buffer, socketType, object->GetClass());
 }
 
 void NetSession::DecodeNetObject(NetPlayerConnection* source, const bool& isActor, ByteBuffer& buffer, const SocketType& socketType)
@@ -254,7 +356,7 @@ void NetSession::DecodeNetObject(NetPlayerConnection* source, const bool& isActo
 						actor->UpdateRole(this);
 
 						actor->DecodeSyncVarRequests(sourceId, buffer, socketType, true);
-						GetGame()->GetCurrentLevel()->m_netActorLookup[actor->m_networkId] = actor;
+						GetGame()->GetCurrentLevel()->m_netActorLookup.Set(actor->m_networkId, actor);
 						actor->OnPostNetInitialize();
 						return;
 					}
@@ -262,7 +364,7 @@ void NetSession::DecodeNetObject(NetPlayerConnection* source, const bool& isActo
 				}
 
 				// Create actor
-				AActor* actor = typeClass->New<AActor>();
+				AActor* actor = typeClass->NewPooled<AActor>();
 				actor->m_networkId = netId;
 				actor->m_networkOwnerId = ownerNetId;
 				actor->UpdateRole(this);
@@ -275,7 +377,7 @@ void NetSession::DecodeNetObject(NetPlayerConnection* source, const bool& isActo
 			// Create object
 			else
 			{
-				OObject* object = typeClass->New<OObject>();
+				OObject* object = typeClass->NewPooled<OObject>();
 				object->m_networkId = netId;
 				object->m_networkOwnerId = ownerNetId;
 				object->UpdateRole(this);
@@ -403,6 +505,7 @@ void NetSession::EncodeNetUpdate(NetPlayerConnection* target, ByteBuffer& buffer
 	Encode<uint16>(buffer, messageCount);
 	if(messageCount != 0)
 		buffer.Push(messageBuffer.Data(), messageBuffer.Size());
+	NET_TRACE_COUNTER("ObjectMessages", messageCount);
 
 
 
@@ -477,6 +580,7 @@ void NetSession::EncodeNetUpdate(NetPlayerConnection* target, ByteBuffer& buffer
 	Encode<uint16>(buffer, messageCount);
 	if (messageCount != 0)
 		buffer.Push(messageBuffer.Data(), messageBuffer.Size());
+	NET_TRACE_COUNTER("ActorMessages", messageCount);
 }
 
 void NetSession::DecodeNetUpdate(NetPlayerConnection* source, ByteBuffer& buffer, const SocketType& socketType)
@@ -552,6 +656,10 @@ void NetSession::DecodeNetUpdate(NetPlayerConnection* source, ByteBuffer& buffer
 	messageCount = 0;
 	if (!Decode<uint16>(buffer, messageCount)) return;
 
+	// Initial sync of this level, so reserve space for every actor up front, rather than growing per actor
+	if (!IsHost() && messageCount != 0 && level->m_netActorLookup.IsEmpty())
+		level->ReserveActors(messageCount);
+
 
 	// Decode actor messages
 	for (uint32 i = 0; i < messageCount; ++i)
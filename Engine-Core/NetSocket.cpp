@@ -1,5 +1,5 @@
-#include "Includes\Core\NetSocket.h"
-#include "Includes\Core\Logger.h"
+#include "Includes/Core/NetSocket.h"
+#include "Includes/Core/Logger.h"
 
 
 NetSocket::NetSocket(SocketType type) : m_socketType(type)
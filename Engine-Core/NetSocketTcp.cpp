@@ -1,4 +1,4 @@
-#include "Includes\Core\NetSocketTcp.h"
+#include "Includes/Core/NetSocketTcp.h"
 
 
 
@@ -79,6 +79,7 @@ bool NetSocketTcp::Poll(std::vector<RawNetPacket>& outPackets)
 				// Put all data into a single packet, for ease of use
 				packet.buffer.Push((const uint8*)sfPacket.getData(), sfPacket.getDataSize());
 				outPackets.emplace_back(packet);
+				m_bytesReceived += sfPacket.getDataSize();
 				received = true;
 			}
 		}
@@ -100,6 +101,7 @@ bool NetSocketTcp::Poll(std::vector<RawNetPacket>& outPackets)
 			// Put all data into a single packet, for ease of use
 			packet.buffer.Push((const uint8*)sfPacket.getData(), sfPacket.getDataSize());
 			outPackets.emplace_back(packet);
+			m_bytesReceived += sfPacket.getDataSize();
 			return true;
 		}
 
@@ -115,26 +117,33 @@ bool NetSocketTcp::SendTo(const uint8* data, uint32 count, NetIdentity identity)
 	sf::Packet sfPacket;
 	sfPacket.append(data, count);
 
+	// Find the socket for this connection
+	sf::TcpSocket* target = nullptr;
 	if (bIsListener)
 	{
-		// Update active connections
 		for (int i = 1; i < m_activeConnections.size(); ++i)
 		{
 			sf::TcpSocket* socket = m_activeConnections[i];
 
 			if (socket->getRemoteAddress() == identity.ip && socket->getRemotePort() == identity.port)
-				return socket->send(sfPacket) == sf::Socket::Status::Done;
+			{
+				target = socket;
+				break;
+			}
 		}
-		return false;
 	}
 	else
 	{
 		sf::TcpSocket* socket = (sf::TcpSocket*)m_socket;
 		if (socket->getRemoteAddress() == identity.ip && socket->getRemotePort() == identity.port)
-			return (socket->send(sfPacket) == sf::Socket::Done);
-		else
-			return false;
+			target = socket;
 	}
+
+	if (target == nullptr || target->send(sfPacket) != sf::Socket::Done)
+		return false;
+
+	m_bytesSent += count;
+	return true;
 }
 
 bool NetSocketTcp::Listen(NetIdentity identity)
@@ -1,4 +1,4 @@
-#include "Includes\Core\NetSocketUdp.h"
+#include "Includes/Core/NetSocketUdp.h"
 
 
 
@@ -36,6 +36,7 @@ bool NetSocketUdp::Poll(std::vector<RawNetPacket>& outPackets)
 		packet.buffer.Push((const uint8*)sfPacket.getData(), sfPacket.getDataSize());
 
 		outPackets.emplace_back(packet);
+		m_bytesReceived += sfPacket.getDataSize();
 		recieved = true;
 	}
 	return recieved;
@@ -55,7 +56,11 @@ bool NetSocketUdp::SendTo(const uint8* data, uint32 count, NetIdentity identity)
 	sf::Packet sfPacket;
 	sfPacket.append(data, count);
 
-	return (m_socket->send(sfPacket, identity.ip, identity.port) == sf::Socket::Done);
+	if (m_socket->send(sfPacket, identity.ip, identity.port) != sf::Socket::Done)
+		return false;
+
+	m_bytesSent += count;
+	return true;
 }
 
 bool NetSocketUdp::Listen(NetIdentity identity)
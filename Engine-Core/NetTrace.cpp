@@ -0,0 +1,174 @@
+#include "Includes/Core/NetTrace.h"
+#include "Includes/Core/ByteBuffer.h"
+#include "Includes/Core/Encoding.h"
+
+#include <vector>
+#include <unordered_map>
+#include <chrono>
+#include <fstream>
+
+
+#define NET_TRACE_MAGIC 0x4352544E // 'NTRC'
+#define NET_TRACE_VERSION 1
+
+
+bool NetTrace::bIsEnabled = false;
+
+static std::vector<NetTrace::Event> s_events;
+static uint32 s_nextEvent = 0;
+static bool bHasWrapped = false;
+static std::chrono::steady_clock::time_point s_startTime;
+
+
+void NetTrace::Enable(const uint32& capacity)
+{
+	s_events.clear();
+	s_events.resize(capacity == 0 ? 1 : capacity);
+	s_nextEvent = 0;
+	bHasWrapped = false;
+	s_startTime = std::chrono::steady_clock::now();
+
+	bIsEnabled = true;
+	LOG("Net trace enabled (Holding %i events)", (uint32)s_events.size());
+}
+
+void NetTrace::Disable()
+{
+	bIsEnabled = false;
+}
+
+uint64 NetTrace::Now()
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - s_startTime).count();
+}
+
+/**
+* Fetch the next event to write over
+*/
+static inline NetTrace::Event& NextEvent()
+{
+	NetTrace::Event& event = s_events[s_nextEvent];
+	if (++s_nextEvent == s_events.size())
+	{
+		s_nextEvent = 0;
+		bHasWrapped = true;
+	}
+	return event;
+}
+
+void NetTrace::RecordSpan(const char* name, const uint64& start, const uint32& arg)
+{
+	if (!bIsEnabled)
+		return;
+
+	Event& event = NextEvent();
+	event.name = name;
+	event.timestamp = start;
+	event.duration = (uint32)(Now() - start);
+	event.value = arg;
+	event.type = EventType::Span;
+}
+
+void NetTrace::RecordCounter(const char* name, const uint32& value)
+{
+	if (!bIsEnabled)
+		return;
+
+	Event& event = NextEvent();
+	event.name = name;
+	event.timestamp = Now();
+	event.duration = 0;
+	event.value = value;
+	event.type = EventType::Counter;
+}
+
+uint32 NetTrace::GetEventCount()
+{
+	return bHasWrapped ? s_events.size() : s_nextEvent;
+}
+
+/**
+* Call func on every held event, from oldest to newest
+*/
+template<typename Func>
+static inline void ForEachEvent(Func func)
+{
+	if (bHasWrapped)
+		for (uint32 i = s_nextEvent; i < s_events.size(); ++i)
+			func(s_events[i]);
+	for (uint32 i = 0; i < s_nextEvent; ++i)
+		func(s_events[i]);
+}
+
+bool NetTrace::DumpChromeJson(const string& path)
+{
+	std::ofstream file(path, std::ios::trunc);
+	if (!file.good())
+	{
+		LOG_ERROR("Unable to write net trace to '%s'", path.c_str());
+		return false;
+	}
+
+	file << "{\"traceEvents\":[\n";
+	bool isFirst = true;
+	ForEachEvent([&file, &isFirst](const Event& event)
+	{
+		if (!isFirst)
+			file << ",\n";
+		isFirst = false;
+
+		if (event.type == EventType::Span)
+			file << "{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":" << event.timestamp << ",\"dur\":" << event.duration << ",\"args\":{\"arg\":" << event.value << "}}";
+		else
+			file << "{\"name\":\"" << event.name << "\",\"ph\":\"C\",\"pid\":1,\"tid\":1,\"ts\":" << event.timestamp << ",\"args\":{\"value\":" << event.value << "}}";
+	});
+	file << "\n]}\n";
+
+	LOG("Wrote %i net trace events to '%s'", GetEventCount(), path.c_str());
+	return true;
+}
+
+bool NetTrace::DumpBinary(const string& path)
+{
+	// Names are only stored as pointers, so build a table of them
+	std::unordered_map<const char*, uint16> nameLookup;
+	std::vector<const char*> names;
+	ForEachEvent([&nameLookup, &names](const Event& event)
+	{
+		if (nameLookup.find(event.name) == nameLookup.end())
+		{
+			nameLookup[event.name] = names.size();
+			names.emplace_back(event.name);
+		}
+	});
+
+	ByteBuffer buffer;
+	buffer.Reserve(16 + GetEventCount() * 19);
+	Encode<uint32>(buffer, NET_TRACE_MAGIC);
+	Encode<uint16>(buffer, NET_TRACE_VERSION);
+
+	Encode<uint32>(buffer, names.size());
+	for (const char* name : names)
+		Encode<const char*>(buffer, name);
+
+	Encode<uint32>(buffer, GetEventCount());
+	ForEachEvent([&nameLookup, &buffer](const Event& event)
+	{
+		Encode<uint16>(buffer, nameLookup[event.name]);
+		Encode<uint8>(buffer, (uint8)event.type);
+		Encode<uint64>(buffer, event.timestamp);
+		Encode<uint32>(buffer, event.duration);
+		Encode<uint32>(buffer, event.value);
+	});
+
+	std::ofstream file(path, std::ios::binary | std::ios::trunc);
+	if (!file.good())
+	{
+		LOG_ERROR("Unable to write net trace to '%s'", path.c_str());
+		return false;
+	}
+	file.write((const char*)buffer.Data(), buffer.Size());
+
+	LOG("Wrote %i net trace events to '%s'", GetEventCount(), path.c_str());
+	return true;
+}
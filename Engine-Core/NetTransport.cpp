@@ -0,0 +1,19 @@
+#include "Includes/Core/NetTransport.h"
+#include "Includes/Core/NetSocketTcp.h"
+#include "Includes/Core/NetSocketUdp.h"
+
+
+NetTransport* NetTransport::GetDefault()
+{
+	static NetSystemTransport transport;
+	return &transport;
+}
+
+
+NetSocket* NetSystemTransport::BuildSocket(const SocketType& type)
+{
+	if (type == TCP)
+		return new NetSocketTcp;
+	else
+		return new NetSocketUdp;
+}
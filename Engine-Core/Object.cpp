@@ -1,6 +1,6 @@
-#include "Includes\Core\Object.h"
-#include "Includes\Core\Game.h"
-#include "Includes\Core\NetSession.h"
+#include "Includes/Core/Object.h"
+#include "Includes/Core/Game.h"
+#include "Includes/Core/NetSession.h"
 
 CLASS_SOURCE(OObject, CORE_API)
 
@@ -1,8 +1,14 @@
-#include "Includes\Core\PlayerController.h"
+#include "Includes/Core/PlayerController.h"
+#ifdef _WIN32
 #include <Windows.h>
+#else
+#include <cstdlib>
+#include <ctime>
+#endif
+#include <random>
 
-#include "Includes\Core\Game.h"
-#include "Includes\Core\LevelController.h"
+#include "Includes/Core/Game.h"
+#include "Includes/Core/LevelController.h"
 
 
 CLASS_SOURCE(OPlayerController, CORE_API)
@@ -48,11 +54,17 @@ void OPlayerController::OnBegin()
 	{
 		// Use PC name as player's name
 		string playerName;
+		// Own generator, as reseeding rand would break replays
+		std::minstd_rand random((uint32)time(nullptr));
+		uint32 id = random() % 10000;
+#ifdef _WIN32
 		TCHAR name[STR_MAX_ENCODE_LEN];
 		DWORD count = STR_MAX_ENCODE_LEN;
-		srand(time(nullptr));
-		uint32 id = rand() % 10000;
 		if (GetUserName(name, &count))
+#else
+		const char* name = getenv("USER");
+		if (name != nullptr)
+#endif
 			m_playerName = string(name) + "_" + std::to_string(id);
 		else
 			m_playerName = "Player_" + std::to_string(id);
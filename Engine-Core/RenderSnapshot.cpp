@@ -0,0 +1,88 @@
+#include "Includes/Core/RenderSnapshot.h"
+
+#ifdef BUILD_CLIENT
+
+
+void RenderSnapshot::Clear()
+{
+	for (RenderLayer& layer : m_layers)
+	{
+		layer.items.clear();
+		layer.meshes.clear();
+	}
+	bHasView = false;
+}
+
+void RenderSnapshot::Draw(sf::RenderWindow* window, SpriteBatch& batch) const
+{
+	if (bHasView)
+		window->setView(sf::View(m_viewCentre, vec2(window->getSize().x, window->getSize().y)));
+
+	const vec2 viewCentre = window->getView().getCenter();
+	const vec2 viewHalfSize = window->getView().getSize() * 0.5f;
+	const vec2 min = viewCentre - viewHalfSize;
+	const vec2 max = viewCentre + viewHalfSize;
+
+	batch.Begin(window);
+	for (const RenderLayer& layer : m_layers)
+	{
+		// Meshes bypass the batch, so anything queued must go first
+		if (layer.meshes.size() != 0)
+		{
+			batch.Flush();
+			for (const RenderMesh& mesh : layer.meshes)
+				DrawMesh(window, mesh);
+		}
+
+		for (const RenderItem& item : layer.items)
+		{
+			// Cull items off screen
+			if (item.location.x + item.size.x < min.x || item.location.y + item.size.y < min.y || item.location.x > max.x || item.location.y > max.y)
+				continue;
+
+			batch.AddQuad(item.location, item.size, item.texture, item.colour);
+		}
+	}
+	batch.End();
+}
+
+void RenderSnapshot::DrawMesh(sf::RenderWindow* window, const RenderMesh& mesh)
+{
+	sf::RenderStates states;
+	states.transform.translate(mesh.location);
+	states.texture = mesh.texture;
+	window->draw(*mesh.vertices, states);
+}
+
+
+RenderSnapshotBuffer::RenderSnapshotBuffer() :
+	m_writeSnapshot(&m_snapshots[0]),
+	m_readySnapshot(&m_snapshots[1]),
+	m_drawSnapshot(&m_snapshots[2])
+{
+}
+
+RenderSnapshot& RenderSnapshotBuffer::BeginWrite()
+{
+	m_writeSnapshot->Clear();
+	return *m_writeSnapshot;
+}
+
+void RenderSnapshotBuffer::Publish()
+{
+	sf::Lock lock(m_swapMutex);
+	std::swap(m_writeSnapshot, m_readySnapshot);
+	bHasNewSnapshot = true;
+}
+
+const RenderSnapshot& RenderSnapshotBuffer::AcquireLatest()
+{
+	sf::Lock lock(m_swapMutex);
+	if (bHasNewSnapshot)
+	{
+		std::swap(m_readySnapshot, m_drawSnapshot);
+		bHasNewSnapshot = false;
+	}
+	return *m_drawSnapshot;
+}
+#endif
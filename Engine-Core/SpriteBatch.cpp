@@ -0,0 +1,44 @@
+#include "Includes/Core/SpriteBatch.h"
+
+#ifdef BUILD_CLIENT
+
+
+void SpriteBatch::Begin(sf::RenderTarget* target)
+{
+	m_target = target;
+	m_texture = nullptr;
+	m_vertices.clear();
+	m_drawCallCount = 0;
+	m_quadCount = 0;
+}
+
+void SpriteBatch::AddQuad(const vec2& location, const vec2& size, const TextureRegion& texture, const Colour& colour)
+{
+	if (texture.texture != m_texture)
+	{
+		Flush();
+		m_texture = texture.texture;
+	}
+
+	const vec2 texMin(texture.rect.left, texture.rect.top);
+	const vec2 texMax(texture.rect.left + texture.rect.width, texture.rect.top + texture.rect.height);
+
+	m_vertices.emplace_back(location, colour, texMin);
+	m_vertices.emplace_back(location + vec2(size.x, 0), colour, vec2(texMax.x, texMin.y));
+	m_vertices.emplace_back(location + size, colour, texMax);
+	m_vertices.emplace_back(location + vec2(0, size.y), colour, vec2(texMin.x, texMax.y));
+	++m_quadCount;
+}
+
+void SpriteBatch::Flush()
+{
+	if (m_vertices.size() == 0 || m_target == nullptr)
+		return;
+
+	sf::RenderStates states;
+	states.texture = m_texture;
+	m_target->draw(&m_vertices[0], m_vertices.size(), sf::Quads, states);
+	m_vertices.clear();
+	++m_drawCallCount;
+}
+#endif
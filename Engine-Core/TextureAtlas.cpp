@@ -0,0 +1,75 @@
+#include "Includes/Core/TextureAtlas.h"
+#include "Includes/Core/Logger.h"
+#include <algorithm>
+
+
+TextureRegion::TextureRegion(const sf::Texture* texture) :
+	texture(texture)
+{
+#ifdef BUILD_CLIENT
+	if (texture != nullptr)
+		rect = sf::IntRect(0, 0, texture->getSize().x, texture->getSize().y);
+#endif
+}
+
+
+#ifdef BUILD_CLIENT
+TextureAtlas::TextureAtlas(const uint32& pageSize, const uint32& padding) :
+	m_pageSize(std::min(pageSize, (uint32)sf::Texture::getMaximumSize())),
+	m_padding(padding)
+{
+}
+
+TextureAtlas::~TextureAtlas()
+{
+	for (Page& page : m_pages)
+		delete page.texture;
+}
+
+TextureAtlas::Page& TextureAtlas::AddPage()
+{
+	// Start cleared, so padding is always transparent
+	sf::Image blank;
+	blank.create(m_pageSize, m_pageSize, sf::Color::Transparent);
+
+	sf::Texture* texture = new sf::Texture;
+	texture->loadFromImage(blank);
+	texture->setSmooth(false);
+	texture->setRepeated(false);
+
+	m_pages.push_back({ texture, 0, 0, 0 });
+	LOG("Created texture atlas page %i (%ix%i)", (uint32)m_pages.size(), m_pageSize, m_pageSize);
+	return m_pages.back();
+}
+
+TextureRegion TextureAtlas::Pack(const sf::Image& image)
+{
+	const uint32 width = image.getSize().x + m_padding;
+	const uint32 height = image.getSize().y + m_padding;
+
+	if (width > m_pageSize || height > m_pageSize)
+		return TextureRegion();
+
+	Page* page = m_pages.size() == 0 ? &AddPage() : &m_pages.back();
+
+	// Start a new shelf, if there is no room left on this one
+	if (page->shelfX + width > m_pageSize)
+	{
+		page->shelfX = 0;
+		page->shelfY += page->shelfHeight;
+		page->shelfHeight = 0;
+	}
+
+	// Start a new page, if there is no room for a new shelf
+	if (page->shelfY + height > m_pageSize)
+		page = &AddPage();
+
+	const uint32 x = page->shelfX;
+	const uint32 y = page->shelfY;
+	page->texture->update(image, x, y);
+
+	page->shelfX += width;
+	page->shelfHeight = std::max(page->shelfHeight, height);
+	return TextureRegion(page->texture, sf::IntRect(x, y, image.getSize().x, image.getSize().y));
+}
+#endif